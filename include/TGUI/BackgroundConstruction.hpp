@@ -0,0 +1,204 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKGROUND_CONSTRUCTION_HPP
+#define TGUI_BACKGROUND_CONSTRUCTION_HPP
+
+#include <TGUI/Container.hpp>
+#include <TGUI/Font.hpp>
+#include <vector>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Gui;
+    class Theme;
+    struct TextureData;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Allows constructing widgets on a worker thread, to attach them to a gui afterwards
+    ///
+    /// Create an instance of this class on the worker thread before constructing the widgets and keep it alive until the
+    /// widgets have been passed to attach. While the object exists, the thread that created it doesn't touch any state that
+    /// is shared with the gui thread:
+    /// - Widgets get their renderers from a theme owned by this object instead of from Theme::getDefault().
+    /// - Widgets get a font owned by this object instead of the global font, as sf::Font isn't safe to share between threads.
+    /// - Images are loaded but not yet uploaded to the graphics card. The upload happens on the gui thread during attach.
+    /// - Svg images aren't rasterized until the widget is drawn for the first time.
+    /// - Layouts are resolved and the position and size signals are emitted immediately, even when the gui to which the
+    ///   widgets will be attached defers or coalesces them.
+    /// - Widgets aren't added to the update scheduler until they are attached.
+    ///
+    /// Operations that are safe on the worker thread while the object exists:
+    /// - Constructing widgets, calling their setters and adding them to containers that were also created on this thread.
+    /// - Loading widgets with Container::loadWidgetsFromFile or loadWidgetsFromStream.
+    /// - Loading textures from files, loading fonts and loading themes from files (with a Theme object created on this thread).
+    /// - Connecting signals.
+    ///
+    /// Operations that are NOT safe on the worker thread:
+    /// - Touching widgets that are attached to a gui, or binding layouts to such widgets.
+    /// - Focusing widgets or starting animations before the widgets are attached.
+    /// - Loading a texture from an sf::Texture, or using Texture::setTextureLoader or Texture::setImageLoader callbacks that
+    ///   aren't thread-safe themselves.
+    ///
+    /// While widgets are being constructed in the background, the gui thread shouldn't call Theme::setDefault, setGlobalFont,
+    /// setGlobalTextSize or Texture::setImageLoader.
+    ///
+    /// The only graphics resources that are still created on the worker thread are the glyph textures of the fonts, because
+    /// SFML renders the glyphs while the text is being measured. SFML activates its own context for that.
+    ///
+    /// @code
+    /// std::thread worker([&gui]{
+    ///     tgui::BackgroundConstruction construction;
+    ///     auto panel = tgui::Panel::create();
+    ///     panel->loadWidgetsFromFile("form.txt");
+    ///     construction.attach(gui, panel, "Form");
+    /// });
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackgroundConstruction
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts constructing widgets in the background on the calling thread
+        ///
+        /// @throw Exception when another BackgroundConstruction object already exists on this thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackgroundConstruction();
+
+
+        // The object is bound to the thread on which it was created
+        BackgroundConstruction(const BackgroundConstruction&) = delete;
+        BackgroundConstruction& operator=(const BackgroundConstruction&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, which ends the background construction on this thread
+        ///
+        /// Textures that were loaded but never passed to the gui thread with attach are uploaded when they are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~BackgroundConstruction();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the object that is constructing widgets on the calling thread
+        ///
+        /// @return Active background construction, or nullptr when this thread isn't constructing widgets in the background
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static BackgroundConstruction* getActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the theme that acts as default theme for the widgets that are constructed on this thread
+        ///
+        /// @param theme  Theme that was created on this thread, or nullptr to use the built-in default theme
+        ///
+        /// The theme should not be used by the gui thread until the widgets have been attached.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTheme(std::shared_ptr<Theme> theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the theme that acts as default theme for the widgets that are constructed on this thread
+        ///
+        /// @return Theme that Theme::getDefault() returns on this thread, or nullptr when it wasn't set or requested yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<Theme> getTheme() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the font that acts as global font for the widgets that are constructed on this thread
+        ///
+        /// @param font  Font that isn't used by the gui thread, or an empty Font to use a new instance of the built-in font
+        ///
+        /// If you changed the global font with setGlobalFont then you should load the same font here again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFont(const Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the font that acts as global font for the widgets that are constructed on this thread
+        ///
+        /// @return Font that getGlobalFont() returns on this thread, or an empty Font when it wasn't set or requested yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Font& getFont() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Hands a widget over to the gui thread, which adds it to the gui
+        ///
+        /// @param gui         Gui to which the widget should be added
+        /// @param widget      Widget that was constructed on this thread and has no parent
+        /// @param widgetName  Name to give to the widget
+        ///
+        /// The widget is added by a task that is posted to the gui (see Gui::post). That task first uploads the textures that
+        /// were loaded on this thread, so the widget appears on screen at once and completely. This thread may no longer touch
+        /// the widget or any of its children after calling this function.
+        ///
+        /// The theme and font of this object are handed over to the gui thread together with the widget. Widgets that are
+        /// constructed after this call get a new theme and font, so setTheme and setFont have to be called again if you want
+        /// the next widgets to use a custom one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void attach(Gui& gui, const Widget::Ptr& widget, const sf::String& widgetName = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Hands a widget over to the gui thread, which adds it to a container in the gui
+        ///
+        /// @param gui         Gui that owns the parent
+        /// @param parent      Container on the gui thread to which the widget should be added
+        /// @param widget      Widget that was constructed on this thread and has no parent
+        /// @param widgetName  Name to give to the widget
+        ///
+        /// @see attach(Gui&, const Widget::Ptr&, const sf::String&)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void attach(Gui& gui, const Container::Ptr& parent, const Widget::Ptr& widget, const sf::String& widgetName = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Remembers a texture of which the upload was postponed, so that attach can upload it on the gui thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addPendingTexture(std::shared_ptr<TextureData> data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::shared_ptr<Theme> m_theme;
+        Font m_font;
+        std::vector<std::shared_ptr<TextureData>> m_pendingTextures; // Textures loaded since the last call to attach
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKGROUND_CONSTRUCTION_HPP
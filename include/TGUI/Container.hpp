@@ -27,7 +27,11 @@
 #define TGUI_CONTAINER_HPP
 
 
+#include <cstdint>
 #include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <TGUI/Widget.hpp>
 
@@ -140,6 +144,9 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// Every container keeps track of the names of all widgets inside it, so looking up a name that is used only once
+        /// (or not at all) doesn't require searching through the widgets.
+        ///
         /// @return Pointer to the earlier added widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -295,6 +302,75 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @param enabled  Should the child widgets be stored in a grid of cells to speed up hit testing?
+        ///
+        /// By default every child widget is checked when the mouse moves, which becomes slow when the container holds thousands
+        /// of widgets. With the index enabled, only the widgets whose bounds overlap the cell below the mouse are checked.
+        /// The bounds of a widget are updated when its position or size changes. Widgets that can react to the mouse outside
+        /// their full size (e.g. a MenuBar with an open menu), or whose full size changes without a call to setSize, should
+        /// not be placed in a container that uses the index. Enabling the index again rebuilds it from scratch.
+        ///
+        /// The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the cells in the spatial index
+        ///
+        /// @param cellSize  Width and height of a single cell
+        ///
+        /// Small cells hold less widgets that need to be checked, but widgets that span many cells are stored more often.
+        /// Cells should thus be roughly the size of a typical child widget. The default cell size is 64.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexCellSize(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the cells in the spatial index
+        ///
+        /// @return Width and height of a single cell
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getSpatialIndexCellSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether containers remember the child widget below the mouse to skip hit testing on mouse moves
+        ///
+        /// @param enabled  Should the widget found by the previous mouse event be checked first?
+        ///
+        /// When the mouse moves, every container on the path to the widget below the mouse normally checks its child widgets
+        /// from front to back. With the cache enabled, a container first checks whether the mouse is still on the child that it
+        /// found the previous time. If it is, and none of the widgets in front of that child that overlap it are below the mouse,
+        /// the search is skipped. The cached result of a container is discarded when a widget inside it is added, removed, moved,
+        /// resized, changes z-order or gets a new renderer property. Just like with the spatial index, widgets that react to the
+        /// mouse outside their full size (e.g. a MenuBar with an open menu or the borders of a resizable ChildWindow) may be
+        /// missed when they lie in front of the cached widget.
+        ///
+        /// The setting is shared by all containers and it is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setHoverCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether containers remember the child widget below the mouse to skip hit testing on mouse moves
+        ///
+        /// @return Is the widget found by the previous mouse event checked first?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isHoverCacheEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -327,6 +403,13 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position or size of one of the child widgets of this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childWidgetBoundsChanged(const Widget* child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -456,6 +539,36 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the top-most widget below the mouse by only checking the widgets stored in the spatial index at that position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findWidgetInSpatialIndex(Vector2f mousePos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the mouse is still only on the widget that was found during the previous call to mouseOnWhichWidget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCachedWidgetBelowMouse(Vector2f mousePos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the widgets in front of the widget below the mouse that overlap it, so that the next call can be checked quickly
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateHoverCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a named widget in the name index of this container and all its parents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNameIndex(const sf::String& widgetName, Widget* widget, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a child widget in the name index, together with the named widgets inside it when it is a container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNameIndexForChild(const Widget::Ptr& widget, const sf::String& widgetName, bool added);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -475,6 +588,26 @@ namespace tgui
 
 
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class Widget; // Widget::invalidateHoverCaches increases m_hoverGeneration
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct SpatialIndex;
+
+        // Grid of cells with the child widgets that overlap them, only exists while the spatial index is enabled
+        std::unique_ptr<SpatialIndex> m_spatialIndex;
+        float m_spatialIndexCellSize = 64;
+
+        // Widgets in front of m_widgetBelowMouse that overlap with it, only valid while the hover generation hasn't changed.
+        // The generation is increased each time a change inside this container could change the widget below the mouse.
+        std::vector<const Widget*> m_hoverOccluders;
+        unsigned int m_hoverGeneration = 1;
+        unsigned int m_hoverCacheGeneration = 0; // Value of m_hoverGeneration when the cache was made, or 0 when there is no cache
+        unsigned int m_hoverCacheEpoch = 0; // Number of times the hover cache had been enabled when the cache was made
+
+        // All widgets with a non-empty name that are located somewhere inside this container
+        std::unordered_map<sf::String, std::vector<Widget*>, StringHash> m_namedDescendants;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -498,6 +631,12 @@ namespace tgui
         GuiContainer();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~GuiContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Doesn't has any effect
         ///
@@ -530,9 +669,155 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts that depend on a changed widget are recalculated immediately or deferred
+        /// @see Gui::setDeferredLayoutResolution
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDeferredLayoutResolution(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts that depend on a changed widget are recalculated deferred
+        /// @see Gui::isDeferredLayoutResolution
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDeferredLayoutResolution() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks a widget in the gui of which the layouts have to be recalculated during the next resolveDeferredLayouts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgetWithChangedLayouts(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the marked widgets and the widgets that depend on them
+        /// @return Amount of widgets that were recalculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t resolveDeferredLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the position and size signals of the widgets in the gui are emitted immediately or coalesced
+        /// @see Gui::setCoalescedGeometrySignals
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCoalescedGeometrySignals(bool coalesced);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the position and size signals of the widgets in the gui are coalesced
+        /// @see Gui::isCoalescedGeometrySignals
+        ///
+        /// This is checked on every position and size change, so it is defined inline.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCoalescedGeometrySignals() const
+        {
+            return m_coalescedGeometrySignals;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget of which a position or size signal is pending to the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueGeometrySignals(Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the position and size signals of the widgets that changed since the last call
+        ///
+        /// The widgets are handled in the order in which they were first changed. Changes made by the signal handlers themselves
+        /// are only emitted during the next call.
+        ///
+        /// @return Amount of widgets for which signals were emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t emitCoalescedGeometrySignals();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the update function of a widget in the gui to be called once the given time has passed
+        /// @see Widget::scheduleUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(Widget& widget, sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules an update for a widget and its children, as long as they are visible
+        ///
+        /// Widgets that weren't part of the gui or that were hidden didn't get their requested updates, this function is called
+        /// when they are added to the gui or shown again so that e.g. animations that were started in the meantime still play.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleVisibleWidgets(Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the update function of the widgets in the gui whose scheduled update is due
+        ///
+        /// @param elapsedTime  Time passed since the previous call
+        ///
+        /// Widgets don't receive an update call every frame. A widget that needs time to pass (e.g. to blink a caret, to end a
+        /// double click or to play an animation) schedules its next update and is only updated once that time has been reached.
+        /// Updates that are due while the widget or one of its parents is hidden are skipped. Updates that are scheduled by the
+        /// update functions themselves are handled during the next call.
+        ///
+        /// Gui::updateTime calls this function, so its cost depends on the amount of widgets that are due instead of the amount
+        /// of widgets in the gui.
+        ///
+        /// @return Amount of widgets that were updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t updateScheduledWidgets(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the total time that was passed to updateScheduledWidgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getSchedulerTime() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the update function of the widget is being called by updateScheduledWidgets
+        ///
+        /// Container::update uses this to only update its children when it is called directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdatingScheduledWidget(const Widget& widget) const
+        {
+            return m_scheduledWidgetBeingUpdated == &widget;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called when a widget, together with all its children, is no longer part of the gui
+        ///
+        /// The widgets may still be waiting on this gui to be recalculated, which now happens immediately.
+        /// Position and size signals that were still pending for the widgets are discarded, as are their scheduled updates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetDetached(Widget& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        struct ScheduledUpdate
+        {
+            sf::Time time;
+            std::uint64_t order; // Widgets that are due at the same time are updated in the order in which they were scheduled
+            Widget* widget;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Comparison function for the heap of scheduled updates, so that the update that is due first is on top
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isScheduledLater(const ScheduledUpdate& left, const ScheduledUpdate& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Functions to maintain the heap of scheduled updates. Unlike std::push_heap and std::pop_heap, they keep the position
+        // of each entry up-to-date in its widget, so that the entry of a widget can be changed or removed without a search.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setScheduledUpdate(std::size_t index, const ScheduledUpdate& entry);
+        void moveScheduledUpdateUp(std::size_t index);
+        void moveScheduledUpdateDown(std::size_t index);
+        void removeScheduledUpdate(std::size_t index);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function does nothing.
@@ -554,6 +839,19 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        bool m_deferredLayoutResolution = false;
+        std::unordered_set<Widget*> m_widgetsWithChangedLayouts; // Widgets that have to be recalculated during the next resolveDeferredLayouts call
+
+        bool m_coalescedGeometrySignals = false;
+        bool m_emittingGeometrySignals = false;
+        std::vector<Widget*> m_widgetsWithPendingGeometrySignals; // Widgets of which onPositionChange or onSizeChange still has to be emitted
+
+        // Min-heap with the pending updates, each widget has at most one entry and knows where it is located
+        std::vector<ScheduledUpdate> m_scheduledUpdates;
+        std::uint64_t m_scheduledUpdateCounter = 0;
+        sf::Time m_schedulerTime;
+        const Widget* m_scheduledWidgetBeingUpdated = nullptr;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
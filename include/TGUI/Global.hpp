@@ -30,6 +30,7 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Font.hpp>
+#include <SFML/System/String.hpp>
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -65,6 +66,7 @@ namespace tgui
     /// @brief Retrieves the default font used for all new widgets
     ///
     /// This function will create the font if there was no global font yet.
+    /// On a thread that constructs widgets with a BackgroundConstruction object, the font of that object is returned.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API Font getGlobalFont();
 
@@ -166,6 +168,16 @@ namespace tgui
     TGUI_API std::string trim(std::string str);
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Hash function object for sf::String, so that strings can be used as keys in unordered containers.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API StringHash
+    {
+        std::size_t operator()(const sf::String& str) const;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/TaskQueue.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -38,6 +39,11 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Gui class
     ///
+    /// Multiple gui objects can each be driven by their own thread. The caches of textures, theme files and widget types
+    /// are shared by all threads, as are the renderers of the default theme. Fonts aren't safe to share between threads,
+    /// so the widgets of each thread should be given their own font (e.g. with setFont) instead of the global font.
+    /// Changing global settings (e.g. setGlobalFont or Theme::setDefault) or renderers that are used by widgets on
+    /// other threads still requires synchronization by the caller.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Gui
     {
@@ -141,10 +147,59 @@ namespace tgui
         ///
         /// You should call this function in your event loop.
         ///
+        /// When mouse moves are coalesced (see setMouseMoveCoalescing), a MouseMoved or TouchMoved event is not handled
+        /// immediately and this function returns false for it.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mouse moves are combined and only handled once per frame
+        ///
+        /// @param coalesce  Should consecutive MouseMoved and TouchMoved events be combined?
+        ///
+        /// A mouse with a high polling rate can produce dozens of moves per frame, each of which would cause the widgets to
+        /// search which widget is below the mouse. When coalescing, handleEvent only remembers the move. The latest position
+        /// is handled once: by the draw function, by processCoalescedMouseMove, or right before the next event that isn't a
+        /// move of the same kind (e.g. a mouse press), so the order in which the other events are handled is unchanged.
+        /// The positions that were skipped can still be retrieved with getCoalescedMousePath.
+        ///
+        /// Mouse moves are not coalesced by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseMoveCoalescing(bool coalesce);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether mouse moves are combined and only handled once per frame
+        ///
+        /// @return Are consecutive MouseMoved and TouchMoved events combined?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseMoveCoalescing() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Handles the mouse move that was postponed because mouse moves are coalesced
+        ///
+        /// @return Has the event been consumed? False when there was no postponed mouse move.
+        ///
+        /// This function is called automatically by the draw function and by handleEvent when needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processCoalescedMouseMove();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all positions of the mouse that were combined into the last coalesced mouse move
+        ///
+        /// @return Positions of the mouse, in the order in which they were received, ending with the latest position
+        ///
+        /// This can be used e.g. by a drawing tool that needs every point the mouse went through. The positions are converted
+        /// to gui coordinates when calling this function. The list is available while the move is being handled and afterwards,
+        /// until the mouse moves again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<Vector2f> getCoalescedMousePath() const;
+
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief While tab key usage is enabled (default), pressing tab will focus another widget
@@ -177,6 +232,110 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts that depend on a changed widget are recalculated immediately or deferred
+        ///
+        /// @param deferred  Should the layouts only be recalculated when updateLayouts is called?
+        ///
+        /// By default a layout is recalculated each time a widget on which it depends changes, which can recalculate the same
+        /// widget many times when lots of widgets are changed at once. When deferred, the widgets in this gui are only marked
+        /// and updateLayouts recalculates each of them once, in dependency order. Disabling it recalculates the marked widgets.
+        /// Widgets that aren't part of a gui always recalculate their layouts immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDeferredLayoutResolution(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts that depend on a changed widget are recalculated deferred
+        ///
+        /// @return Are the layouts only recalculated when updateLayouts is called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDeferredLayoutResolution() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the PositionChanged and SizeChanged signals of the widgets are emitted immediately or coalesced
+        ///
+        /// @param coalesced  Should the signals be postponed until updateLayouts is called?
+        ///
+        /// By default, every change to the position or size of a widget immediately emits the onPositionChange or onSizeChange
+        /// signal. When layouts are still settling (e.g. while the window is being resized), a widget can change several times
+        /// in a row and its handlers get called for each intermediate value. In coalesced mode, a change only marks the widget
+        /// and each signal is emitted at most once per widget, with the final position or size, when updateLayouts is called
+        /// (the draw function does this every frame).
+        ///
+        /// Disabling the coalesced mode emits all signals that were still pending. Widgets that aren't part of the gui always
+        /// emit their signals immediately, and the pending signals of a widget are discarded when it is removed from the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCoalescedGeometrySignals(bool coalesced);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the PositionChanged and SizeChanged signals of the widgets are coalesced
+        ///
+        /// @return Are the signals postponed until updateLayouts is called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCoalescedGeometrySignals() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layouts that depend on widgets that were changed
+        ///
+        /// This only has an effect when layouts are resolved deferred (see setDeferredLayoutResolution), otherwise layouts
+        /// are always up-to-date. Afterwards, the position and size signals that were postponed because they are coalesced
+        /// (see setCoalescedGeometrySignals) are emitted. It is called automatically by the draw function, but you
+        /// can call it yourself when you need the correct positions and sizes before the next draw.
+        ///
+        /// @return Amount of widgets that were recalculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t updateLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be executed by the thread that draws the gui
+        ///
+        /// @param task  Function to execute
+        ///
+        /// Unlike all other functions of the gui and its widgets, this function may be called from any thread. It can be used
+        /// by background threads to change widgets without having to synchronize with the gui thread themselves.
+        /// The tasks are executed in the order in which they were posted, at the start of the draw function or when
+        /// processPostedTasks is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the tasks that were posted with the post function
+        ///
+        /// @param budget  Time after which no new task is started, or sf::Time::Zero to execute all posted tasks
+        ///
+        /// @return Amount of tasks that were executed
+        ///
+        /// This function is called automatically by the draw function (with the budget set by setPostedTaskTimeBudget), but
+        /// you can call it yourself e.g. after handling the events. Tasks that are posted while executing the tasks are
+        /// postponed until the next call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t processPostedTasks(sf::Time budget = sf::Time::Zero);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how long the draw function may spend on executing posted tasks each frame
+        ///
+        /// @param budget  Time after which no new task is started, or sf::Time::Zero to execute all posted tasks (default)
+        ///
+        /// Tasks that don't fit in the budget are executed in the next frame. At least one task is executed per frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPostedTaskTimeBudget(sf::Time budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the draw function may spend on executing posted tasks each frame
+        ///
+        /// @return Time after which no new task is started, or sf::Time::Zero when all posted tasks are executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getPostedTaskTimeBudget() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -407,6 +566,7 @@ namespace tgui
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
         // You will thus only need to call it yourself when you are drawing everything manually.
+        // Only the widgets that scheduled an update that is now due are updated (see GuiContainer::updateScheduledWidgets).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTime(const sf::Time& elapsedTime);
 
@@ -420,6 +580,12 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the event to the widgets without postponing it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool dispatchEvent(sf::Event event);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -447,6 +613,16 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        // The mouse move that is postponed while mouse moves are coalesced, with the pixel positions that were combined in it
+        bool m_mouseMoveCoalescing = false;
+        bool m_mouseMovePending = false;
+        sf::Event m_pendingMouseMove;
+        std::vector<sf::Vector2i> m_coalescedMousePath;
+
+        // Tasks that were posted from any thread to be executed by the gui thread
+        TaskQueue m_postedTasks;
+        sf::Time m_postedTaskTimeBudget;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
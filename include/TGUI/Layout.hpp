@@ -32,6 +32,8 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +41,7 @@ namespace tgui
 {
     class Gui;
     class Widget;
+    class Container;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Class to store the left, top, width or height of a widget
@@ -120,7 +123,7 @@ namespace tgui
         /// @internal
         /// @brief Constructs the layout with a mathematical operation between two other layouts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
+        explicit Layout(Operation operation, Layout leftOperand, Layout rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,7 +170,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isConstant() const
         {
-            return m_operation == Operation::Value;
+            return !m_program;
         }
 
 
@@ -194,57 +197,112 @@ namespace tgui
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout and tell the connected widget about it when the value has changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the value of the layout without informing the connected widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Called by the bound widget when its position or size changed
+        ///
+        /// The value is recalculated right away, unless the widget that uses this layout is part of a gui that resolves its
+        /// layouts deferred. In that case the widget is only scheduled to be recalculated during the next Gui::updateLayouts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void boundWidgetChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the widgets that depend on widgets that changed since the last call
+        ///
+        /// @param widgetsWithChangedLayouts  Widgets of which the layouts have to be recalculated, they are removed from the set
+        ///
+        /// Every widget is recalculated at most once and only after all widgets it depends on were recalculated.
+        /// When widgets depend on each other in a cycle, a warning is printed and they are recalculated in arbitrary order.
+        /// This is called by Gui::updateLayouts with the widgets of that gui.
+        ///
+        /// @return Amount of widgets that were recalculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t resolveDeferredLayouts(std::unordered_set<Widget*>& widgetsWithChangedLayouts);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Single step of a compiled layout expression. The operations are executed on a stack, with Value pushing the constant
+        // value and BindingString pushing the value of m_bindings[binding]. The other operations pop two values and push the result.
+        struct Instruction
+        {
+            Operation operation;
+            float value;
+            std::size_t binding;
+        };
+
+        // Compiled layout expression. Programs are never changed once created, so copies of a layout can share them.
+        struct Program
+        {
+            std::vector<Instruction> instructions;
+            std::vector<std::string> bindingStrings; // String per binding slot, empty when the binding was not made from a string
+            std::size_t stackSize = 1;
+            bool hasBindingStrings = false;
+        };
+
+        // Binding slot of a layout. The operation is BindingString when a string binding hasn't been resolved yet, or Value
+        // when the bound widget was destroyed. The container is only set when binding the inner size of a container.
+        struct Binding
+        {
+            Operation operation = Operation::BindingString;
+            Widget* widget = nullptr;
+            const Container* container = nullptr;
+            float value = 0;
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Parses the expression, the public constructor caches the result of this function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindLayout();
+        static Layout parse(std::string expression);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Tell the bound widgets that the layout no longer binds them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        void unbindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Tell the bound widgets that this layout requires information about changes to their position or size
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        void resetPointers();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Find the widget corresponding to the given name and bind it to the slot if found
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        static void parseBindingString(Binding& binding, const std::string& expression, Widget* widget, bool xAxis);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::shared_ptr<const Program> m_program; // Compiled expression, or nullptr when the layout is a constant
+        std::vector<Binding> m_bindings; // Widgets on which the layout depends, indexed by the binding instructions of the program
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout is not a constant
+        Widget* m_connectedWidget = nullptr; // Widget that uses this layout as its position or size
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
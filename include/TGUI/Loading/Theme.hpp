@@ -28,6 +28,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <atomic>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,9 @@ namespace tgui
         ///
         /// When the theme was loaded before and a renderer with the same name is encountered, the widgets that were using
         /// the old renderer will be reloaded with the new renderer.
+        ///
+        /// The other functions of the theme may be called by multiple threads at the same time, but this function should only
+        /// be called while no other thread is using the theme.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void load(const std::string& primary);
 
@@ -155,6 +159,8 @@ namespace tgui
         /// @warning When setDefault was not called or was given a nullptr as parameter, getDefault will return the default
         ///          theme. If you set textures in this theme then you MUST call setDefault(nullptr) before the end of the
         ///          program to prevent a potential crash due to undefined order of destruction.
+        ///
+        /// On a thread that constructs widgets with a BackgroundConstruction object, the theme of that object is returned.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static Theme* getDefault();
 
@@ -162,7 +168,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static Theme* m_defaultTheme;
+        static std::atomic<Theme*> m_defaultTheme;
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
@@ -141,6 +141,9 @@ namespace tgui
         ///
         /// @param filename  File to remove from cache.
         ///                  If no filename is given, the entire cache is cleared.
+        ///
+        /// Themes can be loaded by multiple threads at the same time, but this function should not be called while another
+        /// thread is still using the properties of the removed files.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void flushCache(const std::string& filename = "");
 
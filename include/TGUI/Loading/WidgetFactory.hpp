@@ -55,9 +55,12 @@ namespace tgui
         ///
         /// @param type  Type of the widget
         ///
-        /// @return Function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>)
+        /// @return Copy of the function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>),
+        ///         or an empty function when the type is unknown
+        ///
+        /// This function may be called from multiple threads at the same time, also while setConstructFunction is called.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const std::function<Widget::Ptr()>& getConstructFunction(const std::string& type);
+        static std::function<Widget::Ptr()> getConstructFunction(const std::string& type);
 
 
 
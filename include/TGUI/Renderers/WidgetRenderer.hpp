@@ -224,6 +224,8 @@ namespace tgui
         /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
         /// @param function Callback function to call when the renderer changes
         ///
+        /// Widgets on different threads may subscribe to the same renderer at the same time, as long as no thread is
+        /// changing the properties of that renderer.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void subscribe(const void* id, const std::function<void(const std::string& property)>& function);
 
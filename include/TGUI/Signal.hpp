@@ -34,6 +34,8 @@
 #include <SFML/System/String.hpp>
 #include <type_traits>
 #include <functional>
+#include <algorithm>
+#include <iterator>
 #include <typeindex>
 #include <memory>
 #include <vector>
@@ -50,7 +52,132 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        // The parameters of an emitted signal are passed to the handlers as a list of pointers. The first one points to the
+        // widget, the others to the values that the signal sends. The list lives on the stack of the emit function, so
+        // different signals can be emitted from different threads at the same time. A single signal is not thread-safe:
+        // its handler list is not synchronized, so it may only be used by one thread at a time.
+        using Parameters = const void* const*;
+
+
+        // The connected handlers of a signal. They are shared with the call function, so that they stay alive when one of
+        // them destroys the widget and the signal with it. While the handlers are being called, no handler is moved or
+        // destroyed: disconnected handlers are only marked and new handlers are stored separately, until the outermost
+        // call finishes. Handlers that are connected during a call are thus only called from the next call onwards.
+        template <typename Function>
+        class HandlerList
+        {
+        public:
+
+            bool empty() const
+            {
+                return m_handlers.empty();
+            }
+
+            void add(unsigned int id, Function function)
+            {
+                if (m_callDepth > 0)
+                    m_addedHandlers.push_back({id, std::move(function), true});
+                else
+                    m_handlers.push_back({id, std::move(function), true});
+            }
+
+            bool remove(unsigned int id)
+            {
+                for (auto* handlers : {&m_handlers, &m_addedHandlers})
+                {
+                    for (auto it = handlers->begin(); it != handlers->end(); ++it)
+                    {
+                        if ((it->id != id) || !it->connected)
+                            continue;
+
+                        // The handler may currently be executing, so it can only be destroyed once the call has finished
+                        if ((m_callDepth > 0) && (handlers == &m_handlers))
+                        {
+                            it->connected = false;
+                            m_removedHandlers = true;
+                        }
+                        else
+                            handlers->erase(it);
+
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            void clear()
+            {
+                if (m_callDepth > 0)
+                {
+                    for (auto& handler : m_handlers)
+                        handler.connected = false;
+
+                    m_addedHandlers.clear();
+                    m_removedHandlers = true;
+                }
+                else
+                    m_handlers.clear();
+            }
+
+            // The list is passed by value to keep it alive, copying the shared pointer doesn't allocate memory
+            template <typename... Args>
+            static void call(std::shared_ptr<HandlerList> list, Args&&... args)
+            {
+                ++list->m_callDepth;
+                const std::size_t handlerCount = list->m_handlers.size();
+                try
+                {
+                    for (std::size_t i = 0; i < handlerCount; ++i)
+                    {
+                        if (list->m_handlers[i].connected)
+                            list->m_handlers[i].function(args...);
+                    }
+                }
+                catch (...)
+                {
+                    list->finishCall();
+                    throw;
+                }
+
+                list->finishCall();
+            }
+
+        private:
+
+            void finishCall()
+            {
+                if (--m_callDepth > 0)
+                    return;
+
+                if (m_removedHandlers)
+                {
+                    m_handlers.erase(std::remove_if(m_handlers.begin(), m_handlers.end(), [](const Handler& handler){ return !handler.connected; }),
+                                     m_handlers.end());
+                    m_removedHandlers = false;
+                }
+
+                if (!m_addedHandlers.empty())
+                {
+                    std::move(m_addedHandlers.begin(), m_addedHandlers.end(), std::back_inserter(m_handlers));
+                    m_addedHandlers.clear();
+                }
+            }
+
+        private:
+
+            struct Handler
+            {
+                unsigned int id;
+                Function function;
+                bool connected;
+            };
+
+            std::vector<Handler> m_handlers;
+            std::vector<Handler> m_addedHandlers; // Handlers that were connected while calling the handlers
+            unsigned int m_callDepth = 0;
+            bool m_removedHandlers = false; // Were handlers disconnected while calling the handlers?
+        };
     }
 
     /// @brief Lists the names of all signals for all widgets
@@ -223,6 +350,7 @@ namespace tgui
 
         using Delegate = std::function<void()>;
         using DelegateEx = std::function<void(std::shared_ptr<Widget>, const std::string&)>;
+        using DelegateParameters = std::function<void(internal_signal::Parameters)>;
 
 
         virtual ~Signal() = default;
@@ -231,14 +359,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param name  Name of the signal
+        ///
+        /// The second parameter, the amount of extra parameters that the signal sends, is no longer needed and only exists
+        /// for compatibility. The parameters are passed directly to the handlers.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(std::string&& name, std::size_t extraParameters = 0) :
+        Signal(std::string&& name, std::size_t = 0) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
         }
 
 
@@ -286,6 +414,17 @@ namespace tgui
         unsigned int connect(const DelegateEx& handler);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects a signal handler that reads the parameters of the signal itself
+        ///
+        /// @param handler  Callback function that is given the list of parameters, as validated by validateTypes
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectWithParameters(const DelegateParameters& handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnect a signal handler from this signal
         ///
@@ -293,13 +432,13 @@ namespace tgui
         ///
         /// @return True when a connection with this id existed and was removed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool disconnect(unsigned int id);
+        virtual bool disconnect(unsigned int id);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnect all signal handler from this signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void disconnectAll();
+        virtual void disconnectAll();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -311,17 +450,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
-            if (m_handlers.empty() || !m_enabled)
-                return false;
-
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
-
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
-
-            return true;
+            const void* parameters[] = {&widget};
+            return emitWithParameters(parameters);
         }
 
 
@@ -373,13 +503,63 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    protected:
+        /// @internal
+        /// @brief Returns a shared pointer to the widget that sends the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<Widget> getWidget(const Widget* widget);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static std::shared_ptr<Widget> getWidget();
+        static std::shared_ptr<Widget> getWidget(internal_signal::Parameters parameters)
+        {
+            return getWidget(*static_cast<const Widget* const*>(parameters[0]));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Generates the id for a new connection. Ids are unique for all signals, in all threads.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int generateUniqueId();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether there are signal handlers connected to this signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return m_handlers && !m_handlers->empty();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stores a new signal handler with the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void addHandler(unsigned int id, DelegateParameters function);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Calls all connected signal handlers with the given parameters
+        ///
+        /// @return True when at least one signal handler was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool emitWithParameters(internal_signal::Parameters parameters)
+        {
+            if (!hasHandlers() || !m_enabled)
+                return false;
+
+            internal_signal::HandlerList<DelegateParameters>::call(m_handlers, parameters);
+            return true;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,59 +567,201 @@ namespace tgui
 
         bool m_enabled = true;
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::shared_ptr<internal_signal::HandlerList<DelegateParameters>> m_handlers; // Only created when the first handler is connected
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Signal that passes its parameters directly to the handlers
+    ///
+    /// Handlers connected with the typed connect functions receive the parameters as they were given to the emit function,
+    /// without going through the type-erased parameter list. Handlers connected by name (e.g. with Widget::connect) keep
+    /// working and are called in the order in which all handlers were connected.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    class SignalTyped : public Signal
+    {
+    public:
+
+        using DelegateTyped = std::function<void(Args...)>;
+        using DelegateTypedEx = std::function<void(std::shared_ptr<Widget>, const std::string&, Args...)>;
+        using Signal::connect;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param name  Name of the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalTyped(std::string&& name) :
+            Signal{std::move(name), sizeof...(Args)}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor which will not copy the signal handlers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalTyped(const SignalTyped& other) :
+            Signal{other}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalTyped(SignalTyped&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy assignment operator which will not copy the signal handlers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalTyped& operator=(const SignalTyped& other)
+        {
+            if (this != &other)
+            {
+                Signal::operator=(other);
+                m_typedHandlers = nullptr;
+            }
+
+            return *this;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SignalTyped& operator=(SignalTyped&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a signal handler that will be called when this signal is emitted
+        ///
+        /// @param handler  Callback function that is given the parameters of the signal as arguments
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connect(const DelegateTyped& handler)
+        {
+            const auto id = generateUniqueId();
+            addTypedHandler(id, [handler](const Widget*, Args... args){ handler(args...); });
+            return id;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Connects a signal handler that will be called when this signal is emitted
+        ///
+        /// @param handler  Callback function that is given a pointer to the widget, the name of the signal and the parameters
+        ///                 of the signal as arguments
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connect(const DelegateTypedEx& handler)
+        {
+            const auto id = generateUniqueId();
+            addTypedHandler(id, [handler, name=m_name](const Widget* widget, Args... args){ handler(getWidget(widget), name, args...); });
+            return id;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Disconnect a signal handler from this signal
+        ///
+        /// @param id  Unique id of the connection returned by the connect function
+        ///
+        /// @return True when a connection with this id existed and was removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool disconnect(unsigned int id) override
+        {
+            return m_typedHandlers && m_typedHandlers->remove(id);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Disconnect all signal handler from this signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectAll() override
+        {
+            if (m_typedHandlers)
+                m_typedHandlers->clear();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Call all connected signal handlers
+        ///
+        /// @param widget  The sender of the signal
+        /// @param args    Parameters to pass to the signal handlers
+        ///
+        /// @return True when at least one signal handler was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool emit(const Widget* widget, Args... args)
+        {
+            if (!m_typedHandlers || m_typedHandlers->empty() || !m_enabled)
+                return false;
+
+            internal_signal::HandlerList<std::function<void(const Widget*, Args...)>>::call(m_typedHandlers, widget, args...);
+            return true;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Handlers that were connected by name read the parameters from a list, which is only created when they are called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addHandler(unsigned int id, DelegateParameters function) override
+        {
+            addTypedHandler(id, [function](const Widget* widget, Args... args){
+                    const void* parameters[] = {&widget, &args...};
+                    function(parameters);
+                });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores a new signal handler with the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTypedHandler(unsigned int id, std::function<void(const Widget*, Args...)> function)
+        {
+            if (!m_typedHandlers)
+                m_typedHandlers = std::make_shared<internal_signal::HandlerList<std::function<void(const Widget*, Args...)>>>();
+
+            m_typedHandlers->add(id, std::move(function));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::shared_ptr<internal_signal::HandlerList<std::function<void(const Widget*, Args...)>>> m_typedHandlers;
     };
 
+
+
     #define TGUI_SIGNAL_VALUE_DECLARATION(TypeName, Type) \
     /**************************************************************************************************************************** \
      * @brief Signal to which the user can subscribe to get callbacks from
      ****************************************************************************************************************************/ \
-    class TGUI_API Signal##TypeName : public Signal \
+    class TGUI_API Signal##TypeName : public SignalTyped<Type> \
     { \
     public: \
         using Delegate##TypeName = std::function<void(Type)>; \
         using Delegate##TypeName##Ex = std::function<void(std::shared_ptr<Widget>, const std::string&, Type)>; \
-        using Signal::connect; \
+        using SignalTyped<Type>::connect; \
         \
         /************************************************************************************************************************ \
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            SignalTyped<Type>{std::move(name)} \
         { \
         } \
         \
-        /************************************************************************************************************************ \
-         * @brief Connects a signal handler that will be called when this signal is emitted
-         *
-         * @param handler  Callback function that is given a Vector2f as argument
-         *
-         * @return Unique id of the connection
-         ************************************************************************************************************************/ \
-        unsigned int connect(const Delegate##TypeName& handler); \
-        \
-        /************************************************************************************************************************ \
-         * @brief Connects a signal handler that will be called when this signal is emitted
-         *
-         * @param handler  Callback function that is given a pointer to the widget, the name of the signal and a Vector2f as arguments
-         *
-         * @return Unique id of the connection
-         ************************************************************************************************************************/ \
-        unsigned int connect(const Delegate##TypeName##Ex& handler); \
-        \
-        /************************************************************************************************************************ \
-         * @internal
-         * @brief Call all connected signal handlers
-         ************************************************************************************************************************/ \
-        bool emit(const Widget* widget, Type param) \
-        { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
-        } \
-        \
     private: \
         /************************************************************************************************************************ \
          * @internal
@@ -671,13 +993,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id, int index)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
-            internal_signal::parameters[3] = static_cast<const void*>(&index);
-            return Signal::emit(widget);
+            const void* parameters[] = {&widget, &item, &id, &index};
+            return emitWithParameters(parameters);
         }
 
 
@@ -721,12 +1038,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, ShowAnimationType type, bool visible)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&type);
-            internal_signal::parameters[2] = static_cast<const void*>(&visible);
-            return Signal::emit(widget);
+            const void* parameters[] = {&widget, &type, &visible};
+            return emitWithParameters(parameters);
         }
 
 
@@ -813,12 +1126,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
-            return Signal::emit(widget);
+            const void* parameters[] = {&widget, &item, &fullItem};
+            return emitWithParameters(parameters);
         }
 
 
@@ -840,6 +1149,46 @@ namespace tgui
 #endif
 
 
+    namespace internal_signal
+    {
+        // Table that is created once per widget class to look up its signals by name. The entries are sorted on their
+        // lowercase name, so that finding a signal doesn't require creating any string. The names are taken from the
+        // signals of the first widget that uses the table, as they are the same for all widgets of the class.
+        template <typename WidgetType>
+        class SignalTable
+        {
+        public:
+
+            using Getter = Signal& (*)(WidgetType&);
+
+            SignalTable(WidgetType& widget, std::initializer_list<Getter> getters)
+            {
+                m_signals.reserve(getters.size());
+                for (const auto& getter : getters)
+                    m_signals.emplace_back(toLower(getter(widget).getName()), getter);
+
+                std::sort(m_signals.begin(), m_signals.end(),
+                          [](const std::pair<std::string, Getter>& left, const std::pair<std::string, Getter>& right){ return left.first < right.first; });
+            }
+
+            // Returns the signal of the widget with the given lowercase name, or nullptr when the table doesn't contain it
+            Signal* find(WidgetType& widget, const std::string& lowercaseName) const
+            {
+                const auto it = std::lower_bound(m_signals.begin(), m_signals.end(), lowercaseName,
+                                                 [](const std::pair<std::string, Getter>& signal, const std::string& name){ return signal.first < name; });
+                if ((it != m_signals.end()) && (it->first == lowercaseName))
+                    return &it->second(widget);
+                else
+                    return nullptr;
+            }
+
+        private:
+
+            std::vector<std::pair<std::string, Getter>> m_signals;
+        };
+    }
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for Widget which provides functionality to connect signals based on their name
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,19 +122,19 @@ namespace tgui
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
 #if defined(__cpp_lib_invoke) && (__cpp_lib_invoke >= 201411L)
-                return [=](const std::shared_ptr<Widget>& widget, const std::string& signalName) {
+                return [=,signalName=signal.getName()](Parameters parameters) {
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                 args...,
-                                widget,
+                                Signal::getWidget(parameters),
                                 signalName,
-                                internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                                internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
 #else
-                return [=,o=offset](const std::shared_ptr<Widget>& widget, const std::string& signalName) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset,signalName=signal.getName()](Parameters parameters) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               widget,
+                               Signal::getWidget(parameters),
                                signalName,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
 #endif
                 };
             }
@@ -156,15 +156,15 @@ namespace tgui
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
 #if defined(__cpp_lib_invoke) && (__cpp_lib_invoke >= 201411L)
-                return [=]{
+                return [=](Parameters parameters){
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
 #else
-                return [=,o=offset]{ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset](Parameters parameters){ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
 #endif
                 };
             }
@@ -279,7 +279,8 @@ namespace tgui
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const BoundArgs&... args)
     {
         unsigned int id;
-        Signal& signal = getSignal(toLower(signalName));
+        signalName = toLower(std::move(signalName));
+        Signal& signal = getSignal(signalName);
 
         if constexpr (std::is_convertible_v<Func, std::function<void(const BoundArgs&...)>>
                    && std::is_invocable_v<decltype(&handler), BoundArgs...>
@@ -309,10 +310,10 @@ namespace tgui
         {
             // Function with unbound arguments
             using binder = internal_signal::func_traits<void, std::decay_t<Func>, BoundArgs...>;
-            id = signal.connect(binder::bind(signal, std::forward<Func>(handler), args...));
+            id = signal.connectWithParameters(binder::bind(signal, std::forward<Func>(handler), args...));
         }
 
-        m_connectedSignals[id] = toLower(signalName);
+        m_connectedSignals[id] = std::move(signalName);
         return id;
     }
 
@@ -320,8 +321,9 @@ namespace tgui
     template <typename Func, typename... Args, typename std::enable_if<std::is_convertible<Func, std::function<void(const Args&...)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const Args&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
-        m_connectedSignals[id] = toLower(signalName);
+        signalName = toLower(std::move(signalName));
+        const unsigned int id = getSignal(signalName).connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
+        m_connectedSignals[id] = std::move(signalName);
         return id;
     }
 
@@ -329,13 +331,14 @@ namespace tgui
                                                                          && std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, BoundArgs&&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect(
+        signalName = toLower(std::move(signalName));
+        const unsigned int id = getSignal(signalName).connect(
                                     [f=std::function<void(const BoundArgs&..., const std::shared_ptr<Widget>&, const std::string&)>(handler), args...]
                                     (const std::shared_ptr<Widget>& w, const std::string& s)
                                     { f(args..., w, s); }
                                 );
 
-        m_connectedSignals[id] = toLower(signalName);
+        m_connectedSignals[id] = std::move(signalName);
         return id;
     }
 
@@ -343,10 +346,11 @@ namespace tgui
                                                                          && !std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, BoundArgs&&... args)
     {
-        Signal& signal = getSignal(toLower(signalName));
+        signalName = toLower(std::move(signalName));
+        Signal& signal = getSignal(signalName);
         using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
-        const unsigned int id = signal.connect(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
-        m_connectedSignals[id] = toLower(signalName);
+        const unsigned int id = signal.connectWithParameters(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
+        m_connectedSignals[id] = std::move(signalName);
         return id;
     }
 #endif
@@ -239,7 +239,8 @@ namespace tgui
 
         Vector2f    m_size;
         Texture     m_texture;
-        aurora::CopiedPtr<sf::Texture> m_svgTexture;
+        mutable aurora::CopiedPtr<sf::Texture> m_svgTexture;
+        mutable bool m_svgRasterizePending = false; // Svg images aren't rasterized in the background, but when first drawn
         std::vector<sf::Vertex> m_vertices;
 
         FloatRect   m_visibleRect;
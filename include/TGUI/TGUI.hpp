@@ -33,6 +33,7 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/BackgroundConstruction.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -48,6 +49,7 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/FlexLayout.hpp>
 #include <TGUI/Widgets/Group.hpp>
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/Widgets/HorizontalLayout.hpp>
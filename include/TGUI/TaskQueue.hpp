@@ -0,0 +1,130 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TASK_QUEUE_HPP
+#define TGUI_TASK_QUEUE_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/Time.hpp>
+#include <functional>
+#include <atomic>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue of tasks that can be filled from any thread and is emptied by a single thread
+    ///
+    /// Adding a task never blocks: the queue is a linked list to which producers append without locking. Only one thread
+    /// (the one owning the gui) may execute the tasks.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TaskQueue
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TaskQueue();
+
+
+        // The queue cannot be copied
+        TaskQueue(const TaskQueue& copy) = delete;
+        TaskQueue& operator=(const TaskQueue& right) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, which destroys the tasks that were never executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TaskQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a task to the queue
+        ///
+        /// @param task  Function to execute
+        ///
+        /// This function may be called from any thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void push(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the tasks in the order in which they were added
+        ///
+        /// @param budget  Time after which no new task is started, or sf::Time::Zero to not limit the time
+        ///
+        /// @return Amount of tasks that were executed
+        ///
+        /// At least one task is executed when the queue isn't empty, even when the budget is too small for it. Tasks that are
+        /// added by the executed tasks themselves are left for the next call, so that this function always returns.
+        /// A task that is still being added by another thread at the time of this call may also be left for the next call.
+        ///
+        /// This function may only be called by one thread at a time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t process(sf::Time budget = sf::Time::Zero);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of tasks that were added but not yet executed
+        ///
+        /// @return Amount of waiting tasks
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTaskCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            std::function<void()> task;
+        };
+
+        // Appends a node at the end of the linked list
+        void pushNode(Node* node);
+
+        // Removes the node at the front of the linked list, returns nullptr when no node is available
+        Node* popNode();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::atomic<Node*> m_head; // Node that was last added, producers replace it
+        Node* m_tail; // Node that will be removed next, only used by the thread executing the tasks
+        Node m_stub; // Empty node that keeps the list from ever being empty
+        std::atomic<std::size_t> m_taskCount{0};
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TASK_QUEUE_HPP
@@ -34,8 +34,10 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/System/String.hpp>
 
 #include <memory>
+#include <atomic>
 #include <string>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +53,8 @@ namespace tgui
         std::unique_ptr<SvgImage> svgImage;
         sf::Texture texture;
         sf::IntRect rect;
+        sf::String filename; // Used by the TextureManager to find the data in its cache
+        std::atomic<bool> uploadPending{false}; // The image was loaded in the background and isn't in the texture yet
 
 #ifndef TGUI_NEXT
         sf::Shader* shader = nullptr;
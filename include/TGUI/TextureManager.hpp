@@ -32,6 +32,8 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <array>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -52,6 +54,7 @@ namespace tgui
         /// @param partRect   Load only part of the image. Don't pass this parameter if you want to load the full image
         ///
         /// The second time you call this function with the same filename, the previously loaded image will be reused.
+        /// This function may be called from multiple threads at the same time.
         ///
         /// @return Texture data when loaded successfully, nullptr otherwise
         ///
@@ -79,10 +82,42 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the texture of which the upload was postponed because the image was loaded in the background
+        ///
+        /// @param data  Texture data that was returned by getTexture while a BackgroundConstruction object was active
+        ///
+        /// This function must be called on the gui thread. It does nothing when the texture was already created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void uploadPendingTexture(const std::shared_ptr<TextureData>& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // The cache is split in shards that are locked separately, so that threads loading different images rarely wait
+        struct ImageMapShard
+        {
+            std::mutex mutex;
+            std::map<sf::String, std::list<TextureDataHolder>> images;
+        };
+
+        static constexpr std::size_t ShardCount = 16;
+
+        // Returns the shard in which the image with the given filename is stored
+        static ImageMapShard& getShard(const sf::String& filename);
+
+        // Looks up the texture in the cache and increments its user count when found, the shard has to be locked
+        static std::shared_ptr<TextureData> findTexture(ImageMapShard& shard, const sf::String& filename, const sf::IntRect& partRect);
+
+        // Loads the image and creates the texture without storing it in the cache
+        static std::shared_ptr<TextureData> loadTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<sf::String, std::list<TextureDataHolder>> m_imageMap;
+        static std::array<ImageMapShard, ShardCount> m_imageMapShards;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
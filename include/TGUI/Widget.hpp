@@ -58,6 +58,7 @@
 namespace tgui
 {
     class Container;
+    class GuiContainer;
 
     enum class ShowAnimationType;
     namespace priv
@@ -391,6 +392,18 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the internal container of the gui to which the widget was added, directly or via its parents
+        ///
+        /// @return Container of the gui, or nullptr when the widget isn't part of a gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiContainer* getGuiContainer() const
+        {
+            return m_guiContainer;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places the widget before all other widgets
         ///
@@ -542,7 +555,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is called every frame with the time passed since the last frame.
+        /// This function is called with the time passed since the previous update, once an update that was requested with
+        /// scheduleUpdate is due. Widgets that need to be updated every frame have to schedule a new update each time.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
@@ -683,6 +697,14 @@ namespace tgui
         void unbindSizeLayout(Layout* layout);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Recalculates the position and size layouts after widgets on which they depend were changed.
+        /// This is called by Layout::resolveDeferredLayouts when layouts are resolved deferred.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLayouts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -776,6 +798,25 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the update function to be called once the given time has passed
+        ///
+        /// @param delay  Time after which the widget has to be updated, a zero time updates it during the next frame
+        ///
+        /// When an update was already scheduled earlier then the earliest of the two times is kept. The elapsed time that will be
+        /// passed to the update function is measured from the moment the widget started waiting for its pending update.
+        /// This function has no effect on widgets that aren't part of a gui, they get an update when they are added to one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent and its ancestors (and the widget itself when it is a container) that the widget below the mouse
+        // has to be searched again on the next mouse event
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateHoverCaches();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw a rectangle shape with the right opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -804,6 +845,19 @@ namespace tgui
         void rendererChangedCallback(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the position or size signal as pending when the gui coalesces geometry signals.
+        // Returns false when the signal has to be emitted immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool queueGeometrySignal(bool& pendingFlag);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the gui that is returned by getGuiContainer for the widget and all its children
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGuiContainer(GuiContainer* guiContainer);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -829,6 +883,12 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
+        // Signals that still have to be emitted when geometry signals are coalesced, and where the widget is in the queue of the gui
+        bool m_positionChangePending = false;
+        bool m_sizeChangePending = false;
+        bool m_geometrySignalsQueued = false;
+        std::size_t m_geometrySignalsQueueIndex = 0;
+
         // Layouts that need to recalculate their value when the position or size of this widget changes
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
@@ -842,6 +902,9 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
+        // Container of the gui that the widget is part of, kept up-to-date when the widget or one of its parents is added or removed
+        GuiContainer* m_guiContainer = nullptr;
+
         // Is the mouse on top of the widget? Did the mouse go down on the widget?
         bool m_mouseHover = false;
         bool m_mouseDown = false;
@@ -855,6 +918,11 @@ namespace tgui
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
+        // Where the scheduled update of the widget is located in the heap of the gui, and the time of the previous update
+        bool m_updateScheduled = false;
+        std::size_t m_scheduledUpdateIndex = 0;
+        sf::Time m_lastUpdateTime;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_draggableWidget = false;
 
@@ -891,6 +959,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Layout; // Layout accesses m_boundPositionLayouts and m_boundSizeLayouts to find the widgets that depend on this one
+        friend class GuiContainer; // GuiContainer emits the geometry signals that were queued by the widget
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
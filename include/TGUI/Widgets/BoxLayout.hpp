@@ -100,6 +100,19 @@ namespace tgui
         virtual void insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets at the end of the layout
+        ///
+        /// @param widgets      Pointers to the widgets you would like to add
+        /// @param widgetNames  Identifiers to access to the widgets later, or an empty list when the widgets don't need names
+        ///
+        /// The widgets are only repositioned once, after all of them have been added.
+        /// If less names than widgets are passed, the remaining widgets get an empty name.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addMultiple(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -134,6 +147,43 @@ namespace tgui
         using Container::get;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes to the layout
+        ///
+        /// Until the matching endUpdate call, adding, inserting and removing widgets or resizing the layout will no longer
+        /// reposition the widgets inside the layout. This only happens once when the last endUpdate is called, so that filling
+        /// a layout with many widgets doesn't reposition all earlier widgets each time a widget is added.
+        /// Calls to beginUpdate and endUpdate can be nested.
+        ///
+        /// @code
+        /// layout->beginUpdate();
+        /// for (const auto& button : buttons)
+        ///     layout->add(button);
+        /// layout->endUpdate();
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate
+        ///
+        /// When this ends the outermost batch, the widgets are repositioned if anything changed since beginUpdate.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch of changes is in progress
+        ///
+        /// @return Has beginUpdate been called more often than endUpdate?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdating() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -146,17 +196,32 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // @brief Repositions and resize the widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateWidgets() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls updateWidgets, or postpones it until endUpdate when a batch of changes is in progress
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestWidgetsUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         float m_spaceBetweenWidgetsCached = 0;
 
+        unsigned int m_updateDepth = 0;
+        bool m_pendingWidgetsUpdate = false; // Were the widgets changed while beginUpdate was active?
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -499,6 +499,53 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a sorted index of the items is kept to speed up searching items by their text
+        ///
+        /// @param enabled  Should the combo box maintain a search index?
+        ///
+        /// @see ListBox::setSearchIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSearchIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a sorted index of the items is kept to speed up searching items by their text
+        /// @return Does the combo box maintain a search index?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSearchIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the items that start with the given text
+        ///
+        /// @param prefix      The text that the items should start with. The comparison is case-insensitive.
+        /// @param maxResults  Maximum number of indices to return, or 0 to return all matching items
+        ///
+        /// @return Indices of the matching items
+        ///
+        /// @see ListBox::findItemsWithPrefix
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> findItemsWithPrefix(const sf::String& prefix, std::size_t maxResults = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether typing while the combo box is focused selects the first item that starts with the typed text
+        ///
+        /// @param enabled  Should typed characters select the matching item?
+        ///
+        /// @see ListBox::setTypeAheadEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTypeAheadEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether typing while the combo box is focused selects the first item that starts with the typed text
+        /// @return Do typed characters select the matching item?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTypeAheadEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the mouse wheel can be used to change the selected item while the list is closed
         ///
@@ -541,6 +588,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseWheelScrolled(float delta, Vector2f pos) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEntered(std::uint32_t key) override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -576,6 +628,13 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called with the time passed since the previous update. While the list is closed, the list box isn't
+        // part of the gui, so the combo box updates it to let it forget the typed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,432 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FLEX_LAYOUT_HPP
+#define TGUI_FLEX_LAYOUT_HPP
+
+#include <TGUI/Widgets/BoxLayout.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Container that arranges its children in rows or columns, growing and shrinking them to fill the available space
+    ///
+    /// The layout works like a flexbox. Every child starts from a basis size along the main direction (by default the size
+    /// that the widget had when it was added), after which the free space in the line is divided between the widgets based on
+    /// their grow factors, or taken from them based on their shrink factors when the widgets don't fit. When wrapping is
+    /// enabled, widgets that no longer fit in a line are moved to the next line.
+    ///
+    /// The geometry of all children is calculated in a single pass whenever the layout changes size. The basis sizes are only
+    /// measured again after widgets are added or removed, or when the properties of the widgets in the layout change.
+    ///
+    /// The space between the widgets and lines is set with the SpaceBetweenWidgets property of the renderer.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FlexLayout : public BoxLayout
+    {
+    public:
+
+        typedef std::shared_ptr<FlexLayout> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const FlexLayout> ConstPtr; ///< Shared constant widget pointer
+
+
+        /// @brief Direction in which the widgets are placed next to each other
+        enum class Direction
+        {
+            Row,   ///< Widgets are placed from left to right, lines are added below each other
+            Column ///< Widgets are placed from top to bottom, lines are added next to each other
+        };
+
+        /// @brief How the free space in a line is used when the widgets don't grow to fill it
+        enum class Justification
+        {
+            Start,        ///< Widgets are placed at the start of the line
+            Center,       ///< Widgets are centered in the line
+            End,          ///< Widgets are placed at the end of the line
+            SpaceBetween, ///< The free space is divided between the widgets, the first and last widget touch the sides
+            SpaceAround   ///< Every widget gets the same amount of free space on both of its sides
+        };
+
+        /// @brief Alignment of the widgets perpendicular to the direction of the layout
+        enum class Alignment
+        {
+            Start,   ///< Align with the top of the line (or the left side in a Column layout)
+            Center,  ///< Center the widgets in the line
+            End,     ///< Align with the bottom of the line (or the right side in a Column layout)
+            Stretch  ///< Make the widgets as high as the line (or as wide as the line in a Column layout)
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout(const Layout2d& size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new flex layout widget
+        ///
+        /// @param size  Size of the layout
+        ///
+        /// @return The new flex layout
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FlexLayout::Ptr create(const Layout2d& size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another layout
+        ///
+        /// @param layout  The other layout
+        ///
+        /// @return The new layout
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr copy(ConstPtr layout);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts a widget to the layout
+        ///
+        /// @param index       Index of the widget in the container
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// The current size of the widget is used as its basis size, the widget doesn't grow and can shrink.
+        ///
+        /// If the index is too high, the widget will simply be added at the end of the list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the container
+        ///
+        /// @param index  Index in the layout of the widget to remove
+        ///
+        /// @return False if the index was too high
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(std::size_t index) override;
+        using BoxLayout::remove;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position or size of one of the child widgets of this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the direction in which the widgets are placed
+        ///
+        /// @param direction  Should the widgets be placed in rows or in columns?
+        ///
+        /// The default direction is Row.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDirection(Direction direction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the direction in which the widgets are placed
+        ///
+        /// @return Are the widgets placed in rows or in columns?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Direction getDirection() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether widgets that don't fit in a line are placed on a new line
+        ///
+        /// @param wrap  Should multiple lines be used?
+        ///
+        /// When wrapping is disabled, all widgets are placed in a single line and will shrink when they don't fit.
+        /// Wrapping is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWrap(bool wrap);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether widgets that don't fit in a line are placed on a new line
+        ///
+        /// @return Are multiple lines used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getWrap() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the free space in a line is distributed when the widgets don't grow to fill it
+        ///
+        /// @param justification  Where should the free space be placed?
+        ///
+        /// The default justification is Start.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setJustification(Justification justification);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the free space in a line is distributed when the widgets don't grow to fill it
+        ///
+        /// @return Where is the free space placed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Justification getJustification() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the alignment of the widgets perpendicular to the direction of the layout
+        ///
+        /// @param alignment  How should the widgets be placed inside their line?
+        ///
+        /// The default alignment is Stretch.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAlignment(Alignment alignment);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the alignment of the widgets perpendicular to the direction of the layout
+        ///
+        /// @return How are the widgets placed inside their line?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Alignment getAlignment() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much a widget grows compared to the other widgets in the line when there is free space
+        ///
+        /// @param widget  Widget from which the grow factor should be changed
+        /// @param grow    Grow factor of the widget, 0 means that the widget never becomes larger than its basis
+        ///
+        /// @return False when the widget was not found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemGrow(const Widget::Ptr& widget, float grow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much a widget grows compared to the other widgets in the line when there is free space
+        ///
+        /// @param widget  Widget from which the grow factor should be returned
+        ///
+        /// @return Grow factor of the widget or 0 when the widget was not found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getItemGrow(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much a widget shrinks compared to the other widgets in the line when the widgets don't fit
+        ///
+        /// @param widget  Widget from which the shrink factor should be changed
+        /// @param shrink  Shrink factor of the widget, 0 means that the widget never becomes smaller than its basis
+        ///
+        /// The amount that a widget shrinks is also proportional to its basis size. The default shrink factor is 1.
+        ///
+        /// @return False when the widget was not found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemShrink(const Widget::Ptr& widget, float shrink);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much a widget shrinks compared to the other widgets in the line when the widgets don't fit
+        ///
+        /// @param widget  Widget from which the shrink factor should be returned
+        ///
+        /// @return Shrink factor of the widget or 0 when the widget was not found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getItemShrink(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of a widget along the direction of the layout before growing or shrinking it
+        ///
+        /// @param widget  Widget from which the basis should be changed
+        /// @param basis   Width (in a Row layout) or height (in a Column layout) from which the widget starts
+        ///
+        /// A negative basis means that the size of the widget at the moment it was added to the layout is used.
+        ///
+        /// @return False when the widget was not found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemBasis(const Widget::Ptr& widget, float basis);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of a widget along the direction of the layout before growing or shrinking it
+        ///
+        /// @param widget  Widget from which the basis should be returned
+        ///
+        /// @return Basis of the widget, which is negative when the widget uses its own size or when the widget wasn't found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getItemBasis(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size below which a widget will never shrink
+        ///
+        /// @param widget       Widget from which the minimum size should be changed
+        /// @param minimumSize  Minimum width and height of the widget
+        ///
+        /// @return False when the widget was not found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemMinimumSize(const Widget::Ptr& widget, Vector2f minimumSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size below which a widget will never shrink
+        ///
+        /// @param widget  Widget from which the minimum size should be returned
+        ///
+        /// @return Minimum width and height of the widget, or (0,0) when the widget was not found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getItemMinimumSize(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size above which a widget will never grow
+        ///
+        /// @param widget       Widget from which the maximum size should be changed
+        /// @param maximumSize  Maximum width and height of the widget, a value of 0 means that there is no maximum
+        ///
+        /// @return False when the widget was not found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemMaximumSize(const Widget::Ptr& widget, Vector2f maximumSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size above which a widget will never grow
+        ///
+        /// @param widget  Widget from which the maximum size should be returned
+        ///
+        /// @return Maximum width and height of the widget, or (0,0) when there is no maximum or the widget was not found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getItemMaximumSize(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // @brief Repositions and resize the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the widget in the layout, or the amount of widgets when it wasn't found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemIndex(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the basis and cross size of every widget, unless this was already done since the last change
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void measureItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Grows or shrinks the widgets in a single line so that they fill the available space
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resolveFlexibleLengths(std::size_t first, std::size_t last, float availableSpace);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forces the widgets to be measured and placed again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateMeasurements();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<FlexLayout>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Item
+        {
+            float grow = 0;
+            float shrink = 1;
+            float basis = -1;
+            Vector2f naturalSize; // Size of the widget when it was added or when it was last resized from outside the layout
+            Vector2f arrangedSize; // Size that the layout gave to the widget
+            Vector2f minimumSize;
+            Vector2f maximumSize;
+        };
+
+        struct Measurement
+        {
+            float hypotheticalMainSize = 0; // Basis clamped between the minimum and maximum size
+            float crossSize = 0;
+            float mainSize = 0; // Size after growing or shrinking
+            bool frozen = false;
+        };
+
+        Direction m_direction = Direction::Row;
+        Justification m_justification = Justification::Start;
+        Alignment m_alignment = Alignment::Stretch;
+        bool m_wrap = false;
+
+        std::vector<Item> m_items;
+
+        std::vector<Measurement> m_measurements;
+        bool m_measurementsValid = false;
+        Vector2f m_arrangedContentSize{-1, -1}; // Size that was available the last time the widgets were placed
+        float m_arrangedSpaceBetweenWidgets = 0;
+        bool m_arrangingWidgets = false;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FLEX_LAYOUT_HPP
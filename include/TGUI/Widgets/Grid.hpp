@@ -305,6 +305,43 @@ namespace tgui
         const std::vector<std::vector<Widget::Ptr>>& getGridWidgets() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes to the grid
+        ///
+        /// Until the matching endUpdate call, adding and removing widgets or changing their size, padding or alignment will
+        /// no longer recalculate the rows and columns and reposition the widgets. This only happens once when the last
+        /// endUpdate is called. While the batch is in progress, an auto-sized grid also won't change its size yet.
+        /// Calls to beginUpdate and endUpdate can be nested.
+        ///
+        /// @code
+        /// grid->beginUpdate();
+        /// for (std::size_t row = 0; row < buttons.size(); ++row)
+        ///     grid->addWidget(buttons[row], row, 0);
+        /// grid->endUpdate();
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate
+        ///
+        /// When this ends the outermost batch, the widgets are repositioned if anything changed since beginUpdate.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch of changes is in progress
+        ///
+        /// @return Has beginUpdate been called more often than endUpdate?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdating() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -357,6 +394,49 @@ namespace tgui
         void updateWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the space needed by the widget in a cell, including its padding
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getRequiredCellSize(std::size_t row, std::size_t column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the height of a single row or the width of a single column. Returns whether the value changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRowHeight(std::size_t row);
+        bool updateColumnWidth(std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the size of the grid to fit the rows and columns when auto-sizing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAutoSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the top of every row and the left of every column, based on the row heights and column widths
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateRowAndColumnPositions(std::vector<float>& rowPositions, std::vector<float>& columnPositions) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the widget inside its cell, using the current row and column positions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePositionOfWidget(std::size_t row, std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the row and column of a cell of which the widget or padding changed and repositions the affected widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cellChanged(std::size_t row, std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a widget in the grid changes size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetSizeChanged(const Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,8 +458,20 @@ namespace tgui
         std::vector<float> m_rowHeight;
         std::vector<float> m_columnWidth;
 
+        // Positions of the rows and columns when the widgets were last placed
+        std::vector<float> m_rowPositions;
+        std::vector<float> m_columnPositions;
+
+        // Cell in which each widget is located
+        std::unordered_map<const Widget*, std::pair<std::size_t, std::size_t>> m_widgetCells;
+
         std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
 
+        // Work that was postponed because beginUpdate was called
+        unsigned int m_updateDepth = 0;
+        bool m_pendingWidgetsUpdate = false;
+        bool m_pendingPositionsUpdate = false;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -69,15 +69,61 @@ namespace tgui
         static Ptr copy(ConstPtr layout);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts a widget to the layout
+        ///
+        /// @param index       Index of the widget in the container
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// Only the line in which the widget is inserted and the lines below it are rearranged.
+        ///
+        /// If the index is too high, the widget will simply be added at the end of the list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the container
+        ///
+        /// @param index  Index in the layout of the widget to remove
+        ///
+        /// @return False if the index was too high
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(std::size_t index) override;
+        using BoxLayout::remove;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position or size of one of the child widgets of this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // @brief Repositions and resize the widgets
+        //
+        // Only the lines starting from the first line that is affected by the changes since the last call are rearranged.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that the widgets starting from the given index have to be placed again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetsChangedFrom(std::size_t index);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +133,26 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Line
+        {
+            std::size_t firstWidget = 0;
+            float top = 0;
+            float maxWidth = 0;     // Largest width of this line and all lines above it
+            float minNextWidth = 0; // Smallest width of this line or a line above it when the next widget would have been added
+        };
+
+        std::vector<Line> m_lines;
+        std::vector<Vector2f> m_placedSizes; // Sizes of the widgets when they were placed
+        float m_placedWidth = 0;
+        float m_placedSpaceBetweenWidgets = 0;
+        bool m_firstWidgetOnSecondLine = false; // Was the first widget too wide to fit, causing an empty line above it?
+        std::size_t m_firstChangedWidget = 0;
+        bool m_placingWidgets = false;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
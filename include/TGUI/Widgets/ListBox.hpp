@@ -31,6 +31,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -466,6 +468,55 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a sorted index of the items is kept to speed up searching items by their text
+        ///
+        /// @param enabled  Should the list box maintain a search index?
+        ///
+        /// When the index is enabled, finding items by their text (e.g. in setSelectedItem, contains or findItemsWithPrefix)
+        /// takes logarithmic time instead of having to look at every item. The index is kept up-to-date when items are added,
+        /// changed or removed, which makes these operations slightly more expensive. It is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSearchIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a sorted index of the items is kept to speed up searching items by their text
+        ///
+        /// @return Does the list box maintain a search index?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSearchIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the items that start with the given text
+        ///
+        /// @param prefix      The text that the items should start with. The comparison is case-insensitive.
+        /// @param maxResults  Maximum number of indices to return, or 0 to return all matching items
+        ///
+        /// @return Indices of the matching items, in the order in which they appear in the list box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> findItemsWithPrefix(const sf::String& prefix, std::size_t maxResults = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether typing while the list box is focused selects the first item that starts with the typed text
+        ///
+        /// @param enabled  Should typed characters select the matching item?
+        ///
+        /// The typed text is forgotten when no character was typed for one second. It is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTypeAheadEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether typing while the list box is focused selects the first item that starts with the typed text
+        ///
+        /// @return Do typed characters select the matching item?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTypeAheadEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the thumb position of the scrollbar
         ///
@@ -505,6 +556,17 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void mouseMoved(Vector2f pos) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEntered(std::uint32_t key) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how long it takes until the typed text is forgotten, or a zero time when no text was typed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getRemainingTypeAheadTime() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,13 +636,68 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Update the color and text style of a single item, if it is currently visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemColorAndStyle(int item);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the text object of a visible item the color and style that matches the state of the item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextColorAndStyle(Text& text, std::size_t item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recycles the text objects from the visible items so that they represent the items in the range [firstItem, lastItem)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forces all text objects of visible items to be recreated the next time the list box is drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateVisibleItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the map that is used to find items based on their id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildItemIdIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the sorted index that is used to find items based on their text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSearchIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the entry of an item from the search index, the index must be enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseFromSearchIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes an item from the search index and moves the items behind it one place up (if the index is enabled)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        void removeFromSearchIndex(std::size_t index);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the color and text style of all the items
+        // Returns the index of the first item with the given text, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndex(const sf::String& item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a typed character to the type-ahead text and returns the index of the item that starts with that text, or -1
+        // when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findTypeAheadItem(std::uint32_t key);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update the color and text style of all the visible items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateItemColorsAndStyle();
 
@@ -625,9 +742,27 @@ namespace tgui
     protected:
 
         // This contains the different items in the list box
-        std::vector<Text>       m_items;
+        std::vector<sf::String> m_items;
         std::vector<sf::String> m_itemIds;
 
+        // Maps an id on the index of the first item with that id
+        std::unordered_map<sf::String, std::size_t, StringHash> m_itemIdIndex;
+
+        // Only the items that are visible have a text object. These objects are reused when the list is scrolled, so that
+        // changes to the font, text size or colors only have to be applied to the visible items instead of to all items.
+        mutable std::vector<Text> m_visibleItems;
+        mutable std::size_t m_firstVisibleItem = 0;
+        mutable bool m_visibleItemsValid = false;
+
+        // Optional index of the items, sorted on the lowercase text, to find items without looking at all of them
+        bool m_searchIndexEnabled = false;
+        std::multimap<sf::String, std::size_t> m_searchIndex;
+
+        // Characters typed while the list box was focused, used to jump to the first item that starts with this text
+        bool m_typeAheadEnabled = false;
+        sf::String m_typeAheadText;
+        sf::Time m_typeAheadTimeElapsed;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -32,6 +32,9 @@
 #include <TGUI/Renderers/ListViewRenderer.hpp>
 #include <TGUI/Text.hpp>
 
+#include <map>
+#include <set>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -59,6 +62,7 @@ namespace tgui
         struct Item
         {
             std::vector<Text> texts;
+            std::vector<float> textWidths; // Width that each text added to the contentWidths of its column, if the column fits its contents
             Sprite icon;
         };
 
@@ -68,6 +72,18 @@ namespace tgui
             float designWidth;
             Text text;
             ColumnAlignment alignment;
+            bool autoFit = false;
+            std::multiset<float> contentWidths; // Widths of all item texts in the column, only filled when autoFit is true
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overrides the look of a single cell, properties that aren't set keep the value from the renderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct CellStyle
+        {
+            Color textColor;        ///< Color of the text in the cell
+            TextStyle textStyle;    ///< Style of the text in the cell
+            Color backgroundColor;  ///< Background color of the cell
         };
 
 
@@ -169,6 +185,29 @@ namespace tgui
         float getColumnWidth(std::size_t index) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the width of a column automatically fits its contents
+        ///
+        /// @param index    Index of the column
+        /// @param autoFit  Should the column become as wide as the widest of its texts (including the header)?
+        ///
+        /// While enabled, the width passed to addColumn or setColumnWidth is ignored. The widths of the items are tracked
+        /// while they are added, changed or removed, so the texts only have to be measured again when the font or
+        /// text size changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setColumnAutoFit(std::size_t index, bool autoFit);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the width of a column automatically fits its contents
+        ///
+        /// @param index  Index of the column
+        ///
+        /// @return Does the column become as wide as the widest of its texts?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getColumnAutoFit(std::size_t index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the text alignment within a column
         ///
@@ -293,6 +332,17 @@ namespace tgui
         bool changeSubItem(std::size_t index, std::size_t column, const sf::String& item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes multiple consecutive items at once
+        ///
+        /// @param startIndex Index of the first item to update
+        /// @param items      Texts for each column, for every item that has to be changed
+        ///
+        /// @return True when the items were updated, false when the range didn't fit inside the list (nothing is changed then)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool changeItems(std::size_t startIndex, const std::vector<std::vector<sf::String>>& items);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes the item from the list view
         ///
@@ -303,12 +353,56 @@ namespace tgui
         bool removeItem(std::size_t index);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes multiple consecutive items from the list view
+        ///
+        /// @param startIndex Index of the first item to remove
+        /// @param count      Amount of items to remove
+        ///
+        /// @return True when the items were removed, false when the range didn't fit inside the list (nothing is removed then)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeItems(std::size_t startIndex, std::size_t count);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes all items from the list
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeAllItems();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes to the items
+        ///
+        /// Until the matching endUpdate call, adding, changing and removing items will no longer recalculate the scrollbars,
+        /// the icon size or auto-scroll the list, and the onItemSelect signal is held back. All of this happens only once
+        /// when the last endUpdate is called. Calls to beginUpdate and endUpdate can be nested.
+        ///
+        /// @code
+        /// listView->beginUpdate();
+        /// for (const auto& row : rows)
+        ///     listView->addItem(row);
+        /// listView->endUpdate();
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate
+        ///
+        /// When this ends the outermost batch, all the work that was postponed since beginUpdate is performed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch of changes is in progress
+        ///
+        /// @return Has beginUpdate been called more often than endUpdate?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdating() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list view
         ///
@@ -405,6 +499,46 @@ namespace tgui
         void sort(std::size_t index, const std::function<bool(const sf::String&, const sf::String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the look of a single cell
+        ///
+        /// @param index   Index of the item
+        /// @param column  Index of the column
+        /// @param style   Colors and text style to use for the cell
+        ///
+        /// Cell styles are stored separately from the items and are only applied while drawing, so changing them is cheap.
+        /// They move along with the item when items are removed or sorted. The style is not used while the item is
+        /// selected or while the mouse is on top of it, so that the selection remains visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCellStyle(std::size_t index, std::size_t column, const CellStyle& style);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the style of a single cell
+        ///
+        /// @param index   Index of the item
+        /// @param column  Index of the column
+        ///
+        /// @return Style of the cell, or a style without any property set if setCellStyle wasn't called for the cell
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CellStyle getCellStyle(std::size_t index, std::size_t column) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the style of a single cell, making it look like the other cells again
+        ///
+        /// @param index   Index of the item
+        /// @param column  Index of the column
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeCellStyle(std::size_t index, std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the styles of all cells
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllCellStyles();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -756,6 +890,38 @@ namespace tgui
         float calculateAutoColumnWidth(const Text& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the widths of the texts of an item to the columns that fit their contents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addAutoFitWidths(Item& item);
+        void removeAutoFitWidths(const Item& item);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Measures all texts of a column again, needed when the font or text size changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remeasureAutoFitColumn(std::size_t column);
+        void remeasureAutoFitColumns();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the width of the columns that fit their contents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAutoFitColumnWidths();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the cell styles of a range of items and moves the styles of the items below it up
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeCellStyles(std::size_t startIndex, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the style of a cell that has to be used while drawing, or a nullptr if it should look like other cells
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const CellStyle* getCellStyleForDrawing(std::size_t index, std::size_t column) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the colors of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -821,6 +987,24 @@ namespace tgui
         void updateHorizontalScrollbarMaximum();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scroll to the bottom after items were added when auto-scrolling is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAutoScroll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Search all items for the largest icon after an icon was removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateMaxIconWidth();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Performs the work that was postponed while a batch of changes was in progress
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the header text for a single column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -862,6 +1046,8 @@ namespace tgui
 
         std::vector<Column> m_columns;
         std::vector<Item>   m_items;
+        std::map<std::pair<std::size_t, std::size_t>, CellStyle> m_cellStyles; // Key is the item index and column index
+        mutable Text m_styledCellText; // Reused while drawing each cell that has its own text color or style
 
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
@@ -890,6 +1076,15 @@ namespace tgui
         bool m_possibleDoubleClick = false; // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_autoScroll = true; // Should the list view scroll to the bottom when a new item is added?
 
+        // Work that was postponed because beginUpdate was called
+        unsigned int m_updateDepth = 0;
+        bool m_pendingVerticalScrollbarUpdate = false;
+        bool m_pendingHorizontalScrollbarUpdate = false;
+        bool m_pendingAutoScroll = false;
+        bool m_pendingMaxIconWidthUpdate = false;
+        bool m_pendingAutoFitColumnWidthsUpdate = false;
+        bool m_pendingItemSelectSignal = false;
+
         // Cached renderer properties
         Borders   m_bordersCached;
         Borders   m_paddingCached;
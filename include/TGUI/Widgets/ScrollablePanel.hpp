@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ScrollablePanelRenderer.hpp>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -393,9 +394,28 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find out what the most right and bottom positions are that are in use by the child widgets
+        // Find out what the most right and bottom positions are that are in use by the child widgets.
+        // Returns whether the position changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateMostBottomRightPosition();
+        bool recalculateMostBottomRightPosition();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Store the bottom right position of a child widget in the sets that are used to find the extent of the content
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertChildBounds(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remove the previously stored bottom right position of a child widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseChildBounds(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when the position or size of a child widget changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childBoundsChanged(const Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,6 +446,11 @@ namespace tgui
 
         std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
 
+        // Bottom right positions of the tracked child widgets, with the edges also sorted so that the maximum is always known
+        std::map<const Widget*, Vector2f> m_childBottomRights;
+        std::multiset<float> m_childRightEdges;
+        std::multiset<float> m_childBottomEdges;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/BackgroundConstruction.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Exception.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        thread_local BackgroundConstruction* activeConstruction = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackgroundConstruction::BackgroundConstruction()
+    {
+        if (activeConstruction)
+            throw Exception{"Only one BackgroundConstruction object can exist per thread."};
+
+        activeConstruction = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackgroundConstruction::~BackgroundConstruction()
+    {
+        activeConstruction = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackgroundConstruction* BackgroundConstruction::getActive()
+    {
+        return activeConstruction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackgroundConstruction::setTheme(std::shared_ptr<Theme> theme)
+    {
+        m_theme = std::move(theme);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Theme> BackgroundConstruction::getTheme() const
+    {
+        return m_theme;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackgroundConstruction::setFont(const Font& font)
+    {
+        m_font = font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Font& BackgroundConstruction::getFont() const
+    {
+        return m_font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackgroundConstruction::attach(Gui& gui, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        attach(gui, gui.getContainer(), widget, widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackgroundConstruction::attach(Gui& gui, const Container::Ptr& parent, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        if (!parent || !widget)
+            throw Exception{"BackgroundConstruction::attach called with a nullptr."};
+
+        if (widget->getParent())
+            throw Exception{"BackgroundConstruction::attach called with a widget that already has a parent."};
+
+        auto pendingTextures = std::move(m_pendingTextures);
+        m_pendingTextures.clear();
+
+        gui.post([parent, widget, widgetName, pendingTextures]{
+            for (const auto& data : pendingTextures)
+                TextureManager::uploadPendingTexture(data);
+
+            parent->add(widget, widgetName);
+        });
+
+        // The attached widgets share the theme and font with the gui thread from now on, so widgets that are constructed
+        // afterwards have to get new ones. Otherwise both threads could e.g. render glyphs into the same font at the same time.
+        m_theme = nullptr;
+        m_font = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackgroundConstruction::addPendingTexture(std::shared_ptr<TextureData> data)
+    {
+        m_pendingTextures.push_back(std::move(data));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
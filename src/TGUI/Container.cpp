@@ -28,8 +28,11 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <unordered_map>
+#include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +42,25 @@ namespace tgui
 
     namespace
     {
+        bool hoverCacheEnabled = false;
+
+        // Increased each time the hover cache is enabled. While it is disabled, changes to the widgets don't invalidate the
+        // caches, so caches made before the cache was disabled are ignored once it gets enabled again.
+        unsigned int hoverCacheEpoch = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isVisibleWithParents(const Widget& widget)
+        {
+            for (const Widget* visibleWidget = &widget; visibleWidget; visibleWidget = visibleWidget->getParent())
+            {
+                if (!visibleWidget->isVisible())
+                    return false;
+            }
+
+            return true;
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         void getAllRenderers(std::map<RendererData*, std::vector<const Widget*>>& renderers, const Container* container)
@@ -100,6 +122,132 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct Container::SpatialIndex
+    {
+        // Widgets that would have to be stored in more cells than this are checked for every mouse position instead
+        static constexpr int MaxCellsPerWidget = 256;
+
+        struct Entry
+        {
+            int left = 0;
+            int top = 0;
+            int right = 0;
+            int bottom = 0;
+            bool oversized = false;
+            bool outdated = false; // Is the widget in the list of widgets of which the bounds still need to be updated?
+            std::size_t order = 0; // Index of the widget in m_widgets, may be outdated when the z-order changed
+        };
+
+        explicit SpatialIndex(float size) :
+            cellSize{size}
+        {
+        }
+
+        static std::uint64_t getCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        int getCellCoordinate(float pos) const
+        {
+            return static_cast<int>(std::floor(pos / cellSize));
+        }
+
+        void insert(const Widget* widget, std::size_t order)
+        {
+            const Vector2f topLeft = widget->getPosition() + widget->getWidgetOffset();
+            const Vector2f bottomRight = topLeft + widget->getFullSize();
+
+            Entry entry;
+            entry.order = order;
+
+            // Widgets with huge or invalid bounds aren't worth spreading over the cells
+            const float cellsWide = (bottomRight.x - topLeft.x) / cellSize;
+            const float cellsHigh = (bottomRight.y - topLeft.y) / cellSize;
+            if (!((cellsWide + 1) * (cellsHigh + 1) <= MaxCellsPerWidget)
+             || !(std::abs(topLeft.x / cellSize) < 1e6f) || !(std::abs(topLeft.y / cellSize) < 1e6f))
+            {
+                entry.oversized = true;
+                oversizedWidgets.push_back(widget);
+            }
+            else
+            {
+                entry.left = getCellCoordinate(topLeft.x);
+                entry.top = getCellCoordinate(topLeft.y);
+                entry.right = getCellCoordinate(bottomRight.x);
+                entry.bottom = getCellCoordinate(bottomRight.y);
+                for (int y = entry.top; y <= entry.bottom; ++y)
+                {
+                    for (int x = entry.left; x <= entry.right; ++x)
+                        cells[getCellKey(x, y)].push_back(widget);
+                }
+            }
+
+            entries[widget] = entry;
+        }
+
+        void remove(const Widget* widget)
+        {
+            const auto entryIt = entries.find(widget);
+            if (entryIt == entries.end())
+                return;
+
+            const Entry& entry = entryIt->second;
+            if (entry.oversized)
+                eraseWidget(oversizedWidgets, widget);
+            else
+            {
+                for (int y = entry.top; y <= entry.bottom; ++y)
+                {
+                    for (int x = entry.left; x <= entry.right; ++x)
+                    {
+                        const auto cellIt = cells.find(getCellKey(x, y));
+                        eraseWidget(cellIt->second, widget);
+                        if (cellIt->second.empty())
+                            cells.erase(cellIt);
+                    }
+                }
+            }
+
+            entries.erase(entryIt);
+        }
+
+        void updateOutdatedWidgets()
+        {
+            for (const Widget* widget : outdatedWidgets)
+            {
+                // The widget could have been removed from the container since it was marked
+                const auto entryIt = entries.find(widget);
+                if (entryIt == entries.end())
+                    continue;
+
+                const std::size_t order = entryIt->second.order;
+                remove(widget);
+                insert(widget, order);
+            }
+
+            outdatedWidgets.clear();
+        }
+
+        static void eraseWidget(std::vector<const Widget*>& widgets, const Widget* widget)
+        {
+            const auto it = std::find(widgets.begin(), widgets.end(), widget);
+            *it = widgets.back();
+            widgets.pop_back();
+        }
+
+        float cellSize;
+        std::unordered_map<std::uint64_t, std::vector<const Widget*>> cells;
+        std::unordered_map<const Widget*, Entry> entries;
+        std::vector<const Widget*> oversizedWidgets;
+        std::vector<const Widget*> outdatedWidgets;
+
+        // Reused between calls to avoid allocating memory on every mouse move
+        std::vector<std::pair<std::size_t, const Widget*>> candidates;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container()
     {
         m_containerWidget = true;
@@ -108,8 +256,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget                {other},
+        m_spatialIndexCellSize{other.m_spatialIndexCellSize}
     {
+        if (other.m_spatialIndex)
+            m_spatialIndex = std::make_unique<SpatialIndex>(m_spatialIndexCellSize);
+
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
@@ -123,7 +275,14 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_spatialIndex        {std::move(other.m_spatialIndex)},
+        m_spatialIndexCellSize{std::move(other.m_spatialIndexCellSize)},
+        m_hoverOccluders      {std::move(other.m_hoverOccluders)},
+        m_hoverGeneration     {std::move(other.m_hoverGeneration)},
+        m_hoverCacheGeneration{std::move(other.m_hoverCacheGeneration)},
+        m_hoverCacheEpoch     {std::move(other.m_hoverCacheEpoch)},
+        m_namedDescendants    {std::move(other.m_namedDescendants)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
@@ -157,6 +316,12 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            m_spatialIndexCellSize = right.m_spatialIndexCellSize;
+            if (right.m_spatialIndex)
+                m_spatialIndex = std::make_unique<SpatialIndex>(m_spatialIndexCellSize);
+            else
+                m_spatialIndex = nullptr;
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
@@ -181,6 +346,13 @@ namespace tgui
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_spatialIndex         = std::move(right.m_spatialIndex);
+            m_spatialIndexCellSize = std::move(right.m_spatialIndexCellSize);
+            m_hoverOccluders       = std::move(right.m_hoverOccluders);
+            m_hoverGeneration      = std::move(right.m_hoverGeneration);
+            m_hoverCacheGeneration = std::move(right.m_hoverCacheGeneration);
+            m_hoverCacheEpoch      = std::move(right.m_hoverCacheEpoch);
+            m_namedDescendants     = std::move(right.m_namedDescendants);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
@@ -207,7 +379,7 @@ namespace tgui
             {
                 m_prevInnerSize = getInnerSize();
                 for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                    layout->boundWidgetChanged();
             }
         }
     }
@@ -221,6 +393,12 @@ namespace tgui
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
+        invalidateHoverCaches();
+
+        if (m_spatialIndex)
+            m_spatialIndex->insert(widgetPtr.get(), m_widgets.size() - 1);
+
+        updateNameIndexForChild(widgetPtr, widgetName, true);
 
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
@@ -233,6 +411,18 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
+        // Widgets without a name aren't stored in the index
+        if (!widgetName.isEmpty())
+        {
+            const auto it = m_namedDescendants.find(widgetName);
+            if (it == m_namedDescendants.end())
+                return nullptr;
+
+            // If only one widget has this name then it is the one that the search below would find
+            if (it->second.size() == 1)
+                return it->second.front()->shared_from_this();
+        }
+
         for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
         {
             if (m_widgetNames[i] == widgetName)
@@ -274,10 +464,16 @@ namespace tgui
                     widget->setFocused(false);
                 }
 
+                if (m_spatialIndex)
+                    m_spatialIndex->remove(widget.get());
+
+                updateNameIndexForChild(widget, m_widgetNames[i], false);
+
                 // Remove the widget
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                invalidateHoverCaches();
                 return true;
             }
         }
@@ -289,11 +485,23 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        // Only the parents still need to forget about the names, the index of this container can simply be cleared
+        if (getParent() && !m_namedDescendants.empty())
+        {
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                getParent()->updateNameIndexForChild(m_widgets[i], m_widgetNames[i], false);
+        }
+        m_namedDescendants.clear();
+
         for (const auto& widget : m_widgets)
             widget->setParent(nullptr);
 
         m_widgets.clear();
         m_widgetNames.clear();
+        invalidateHoverCaches();
+
+        if (m_spatialIndex)
+            m_spatialIndex = std::make_unique<SpatialIndex>(m_spatialIndexCellSize);
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
@@ -307,7 +515,9 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                updateNameIndex(m_widgetNames[i], widget.get(), false);
                 m_widgetNames[i] = name;
+                updateNameIndex(m_widgetNames[i], widget.get(), true);
                 return true;
             }
         }
@@ -402,7 +612,7 @@ namespace tgui
             }
             else // Section describes a widget
             {
-                const auto& constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
+                const auto constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
                 if (constructor)
                 {
                     Widget::Ptr widget = constructor();
@@ -460,6 +670,8 @@ namespace tgui
 
     void Container::moveWidgetToFront(const Widget::Ptr& widget)
     {
+        invalidateHoverCaches();
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
@@ -481,6 +693,8 @@ namespace tgui
 
     void Container::moveWidgetToBack(const Widget::Ptr& widget)
     {
+        invalidateHoverCaches();
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
@@ -502,6 +716,65 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (enabled)
+        {
+            m_spatialIndex = std::make_unique<SpatialIndex>(m_spatialIndexCellSize);
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                m_spatialIndex->insert(m_widgets[i].get(), i);
+        }
+        else
+            m_spatialIndex = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexCellSize(float cellSize)
+    {
+        if (cellSize <= 0)
+            throw Exception{"The cell size of the spatial index has to be positive."};
+
+        m_spatialIndexCellSize = cellSize;
+
+        // Rebuild the index with the new cell size
+        if (m_spatialIndex)
+            setSpatialIndexEnabled(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Container::getSpatialIndexCellSize() const
+    {
+        return m_spatialIndexCellSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setHoverCacheEnabled(bool enabled)
+    {
+        if (enabled && !hoverCacheEnabled)
+            ++hoverCacheEpoch;
+
+        hoverCacheEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isHoverCacheEnabled()
+    {
+        return hoverCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -610,6 +883,23 @@ namespace tgui
             setFocused(true);
     }
 
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (!m_spatialIndex)
+            return;
+
+        // The widget may not have been added to the index yet when its layout is recalculated while being added.
+        // The bounds are only updated when needed, as some widgets only update their full size after calling setSize.
+        const auto entryIt = m_spatialIndex->entries.find(child);
+        if ((entryIt != m_spatialIndex->entries.end()) && !entryIt->second.outdated)
+        {
+            entryIt->second.outdated = true;
+            m_spatialIndex->outdatedWidgets.push_back(child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::leftMousePressed(Vector2f pos)
@@ -827,7 +1117,7 @@ namespace tgui
             const auto nameSeparator = childNode->name.find('.');
             const auto widgetType = childNode->name.substr(0, nameSeparator);
 
-            const auto& constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
+            const auto constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
             if (constructor)
             {
                 std::string className;
@@ -849,12 +1139,16 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // The scheduler of the gui updates the children separately when they requested it, only direct calls update them here
+        if (!m_guiContainer || !m_guiContainer->isUpdatingScheduledWidget(*this))
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            // Loop through all widgets
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            {
+                // Update the elapsed time in widgets that need it
+                if (m_widgets[i]->isVisible())
+                    m_widgets[i]->update(elapsedTime);
+            }
         }
 
         m_animationTimeElapsed = {};
@@ -1046,17 +1340,25 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
+        if (hoverCacheEnabled && isCachedWidgetBelowMouse(mousePos))
+            return m_widgetBelowMouse;
+
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
+            widget = findWidgetInSpatialIndex(mousePos);
+        else
         {
-            if ((*it)->isVisible())
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                if ((*it)->isVisible())
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
 
-                    break;
+                        break;
+                    }
                 }
             }
         }
@@ -1066,11 +1368,159 @@ namespace tgui
             m_widgetBelowMouse->mouseNoLongerOnWidget();
 
         m_widgetBelowMouse = widget;
+
+        if (hoverCacheEnabled)
+            updateHoverCache();
+        else
+            m_hoverCacheGeneration = 0; // The cache no longer belongs to the widget below the mouse
+
         return widget;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isCachedWidgetBelowMouse(Vector2f mousePos) const
+    {
+        if (!m_widgetBelowMouse || (m_hoverCacheGeneration != m_hoverGeneration) || (m_hoverCacheEpoch != hoverCacheEpoch))
+            return false;
+
+        if (!m_widgetBelowMouse->isVisible() || !m_widgetBelowMouse->isEnabled() || !m_widgetBelowMouse->mouseOnWidget(mousePos))
+            return false;
+
+        // Visibility changes aren't tracked, so the widgets in front are checked even when they were hidden when caching them
+        for (const Widget* occluder : m_hoverOccluders)
+        {
+            if (occluder->isVisible() && occluder->mouseOnWidget(mousePos))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateHoverCache()
+    {
+        m_hoverOccluders.clear();
+        if (!m_widgetBelowMouse)
+            return;
+
+        const FloatRect bounds{m_widgetBelowMouse->getPosition() + m_widgetBelowMouse->getWidgetOffset(), m_widgetBelowMouse->getFullSize()};
+
+        auto it = std::find(m_widgets.begin(), m_widgets.end(), m_widgetBelowMouse);
+        assert(it != m_widgets.end());
+        for (++it; it != m_widgets.end(); ++it)
+        {
+            if (bounds.intersects({(*it)->getPosition() + (*it)->getWidgetOffset(), (*it)->getFullSize()}))
+                m_hoverOccluders.push_back(it->get());
+        }
+
+        m_hoverCacheGeneration = m_hoverGeneration;
+        m_hoverCacheEpoch = hoverCacheEpoch;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndex(const sf::String& widgetName, Widget* widget, bool added)
+    {
+        if (widgetName.isEmpty())
+            return;
+
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (added)
+                container->m_namedDescendants[widgetName].push_back(widget);
+            else
+            {
+                const auto it = container->m_namedDescendants.find(widgetName);
+                if (it == container->m_namedDescendants.end())
+                    continue;
+
+                auto& widgets = it->second;
+                const auto widgetIt = std::find(widgets.begin(), widgets.end(), widget);
+                if (widgetIt == widgets.end())
+                    continue;
+
+                *widgetIt = widgets.back();
+                widgets.pop_back();
+                if (widgets.empty())
+                    container->m_namedDescendants.erase(it);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndexForChild(const Widget::Ptr& widget, const sf::String& widgetName, bool added)
+    {
+        updateNameIndex(widgetName, widget.get(), added);
+
+        if (widget->isContainer())
+        {
+            for (const auto& pair : std::static_pointer_cast<Container>(widget)->m_namedDescendants)
+            {
+                for (Widget* descendant : pair.second)
+                    updateNameIndex(pair.first, descendant, added);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::findWidgetInSpatialIndex(Vector2f mousePos)
+    {
+        m_spatialIndex->updateOutdatedWidgets();
+
+        auto& candidates = m_spatialIndex->candidates;
+        candidates.clear();
+
+        const auto addCandidates = [&](const std::vector<const Widget*>& widgets)
+            {
+                for (const Widget* widget : widgets)
+                    candidates.emplace_back(m_spatialIndex->entries[widget].order, widget);
+            };
+
+        const auto cellIt = m_spatialIndex->cells.find(SpatialIndex::getCellKey(m_spatialIndex->getCellCoordinate(mousePos.x),
+                                                                                m_spatialIndex->getCellCoordinate(mousePos.y)));
+        if (cellIt != m_spatialIndex->cells.end())
+            addCandidates(cellIt->second);
+
+        addCandidates(m_spatialIndex->oversizedWidgets);
+
+        // The stored indices become outdated when widgets are removed or change z-order, renumber them when we notice it
+        for (auto& candidate : candidates)
+        {
+            if ((candidate.first < m_widgets.size()) && (m_widgets[candidate.first].get() == candidate.second))
+                continue;
+
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                m_spatialIndex->entries[m_widgets[i].get()].order = i;
+
+            for (auto& candidateToUpdate : candidates)
+                candidateToUpdate.first = m_spatialIndex->entries[candidateToUpdate.second].order;
+
+            break;
+        }
+
+        // Check the widgets from front to back, just like when no index is used
+        std::sort(candidates.begin(), candidates.end(), [](const std::pair<std::size_t, const Widget*>& left, const std::pair<std::size_t, const Widget*>& right){ return left.first > right.first; });
+        for (const auto& candidate : candidates)
+        {
+            const Widget::Ptr& widget = m_widgets[candidate.first];
+            if (widget->isVisible() && widget->mouseOnWidget(mousePos))
+            {
+                if (widget->isEnabled())
+                    return widget;
+                else
+                    return nullptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
         // Draw all widgets when they are visible
@@ -1141,6 +1591,29 @@ namespace tgui
         m_type = "GuiContainer";
         m_focused = true;
         m_isolatedFocus = true;
+        m_guiContainer = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GuiContainer::~GuiContainer()
+    {
+        // The widgets are no longer part of the gui when the Container destructor removes them
+        setGuiContainer(nullptr);
+
+        // The widgets may outlive the gui, so they shouldn't think that they are still in its queue
+        for (Widget* widget : m_widgetsWithPendingGeometrySignals)
+        {
+            if (!widget)
+                continue;
+
+            widget->m_positionChangePending = false;
+            widget->m_sizeChangePending = false;
+            widget->m_geometrySignalsQueued = false;
+        }
+
+        for (const auto& entry : m_scheduledUpdates)
+            entry.widget->m_updateScheduled = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1171,6 +1644,307 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiContainer::isScheduledLater(const ScheduledUpdate& left, const ScheduledUpdate& right)
+    {
+        if (left.time != right.time)
+            return left.time > right.time;
+        else
+            return left.order > right.order;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::setScheduledUpdate(std::size_t index, const ScheduledUpdate& entry)
+    {
+        m_scheduledUpdates[index] = entry;
+        entry.widget->m_scheduledUpdateIndex = index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::moveScheduledUpdateUp(std::size_t index)
+    {
+        const ScheduledUpdate entry = m_scheduledUpdates[index];
+        while (index > 0)
+        {
+            const std::size_t parentIndex = (index - 1) / 2;
+            if (!isScheduledLater(m_scheduledUpdates[parentIndex], entry))
+                break;
+
+            setScheduledUpdate(index, m_scheduledUpdates[parentIndex]);
+            index = parentIndex;
+        }
+
+        setScheduledUpdate(index, entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::moveScheduledUpdateDown(std::size_t index)
+    {
+        const ScheduledUpdate entry = m_scheduledUpdates[index];
+        while (true)
+        {
+            std::size_t childIndex = 2 * index + 1;
+            if (childIndex >= m_scheduledUpdates.size())
+                break;
+
+            if ((childIndex + 1 < m_scheduledUpdates.size()) && isScheduledLater(m_scheduledUpdates[childIndex], m_scheduledUpdates[childIndex + 1]))
+                ++childIndex;
+
+            if (!isScheduledLater(entry, m_scheduledUpdates[childIndex]))
+                break;
+
+            setScheduledUpdate(index, m_scheduledUpdates[childIndex]);
+            index = childIndex;
+        }
+
+        setScheduledUpdate(index, entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::removeScheduledUpdate(std::size_t index)
+    {
+        m_scheduledUpdates[index].widget->m_updateScheduled = false;
+
+        // The last entry takes the place of the removed one and is then moved to where it belongs
+        const std::size_t lastIndex = m_scheduledUpdates.size() - 1;
+        if (index != lastIndex)
+            setScheduledUpdate(index, m_scheduledUpdates[lastIndex]);
+
+        m_scheduledUpdates.pop_back();
+        if (index == lastIndex)
+            return;
+
+        if ((index > 0) && isScheduledLater(m_scheduledUpdates[(index - 1) / 2], m_scheduledUpdates[index]))
+            moveScheduledUpdateUp(index);
+        else
+            moveScheduledUpdateDown(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::setDeferredLayoutResolution(bool deferred)
+    {
+        m_deferredLayoutResolution = deferred;
+
+        // Layouts that are still waiting to be recalculated are resolved immediately when deferred resolution is disabled
+        if (!deferred)
+            resolveDeferredLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiContainer::isDeferredLayoutResolution() const
+    {
+        return m_deferredLayoutResolution;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::addWidgetWithChangedLayouts(Widget* widget)
+    {
+        m_widgetsWithChangedLayouts.insert(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GuiContainer::resolveDeferredLayouts()
+    {
+        return Layout::resolveDeferredLayouts(m_widgetsWithChangedLayouts);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::setCoalescedGeometrySignals(bool coalesced)
+    {
+        m_coalescedGeometrySignals = coalesced;
+
+        if (!coalesced)
+            emitCoalescedGeometrySignals();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::queueGeometrySignals(Widget& widget)
+    {
+        widget.m_geometrySignalsQueued = true;
+        widget.m_geometrySignalsQueueIndex = m_widgetsWithPendingGeometrySignals.size();
+        m_widgetsWithPendingGeometrySignals.push_back(&widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GuiContainer::emitCoalescedGeometrySignals()
+    {
+        // A handler that updates the gui could end up here again, the signals it caused will be emitted during the next call
+        if (m_emittingGeometrySignals || m_widgetsWithPendingGeometrySignals.empty())
+            return 0;
+
+        m_emittingGeometrySignals = true;
+
+        // Widgets that are removed from the gui by a handler replace their entry with a nullptr. Widgets that are changed again
+        // by a handler after their signals were emitted are added to the back of the list, behind the ones handled in this call.
+        std::size_t widgetCount = 0;
+        const std::size_t queueSize = m_widgetsWithPendingGeometrySignals.size();
+        for (std::size_t i = 0; i < queueSize; ++i)
+        {
+            Widget* widget = m_widgetsWithPendingGeometrySignals[i];
+            if (!widget)
+                continue;
+
+            ++widgetCount;
+            if (widget->m_positionChangePending)
+            {
+                widget->m_positionChangePending = false;
+                widget->onPositionChange.emit(widget, widget->getPosition());
+                if (!m_widgetsWithPendingGeometrySignals[i])
+                    continue;
+            }
+
+            if (widget->m_sizeChangePending)
+            {
+                widget->m_sizeChangePending = false;
+                widget->onSizeChange.emit(widget, widget->getSize());
+                if (!m_widgetsWithPendingGeometrySignals[i])
+                    continue;
+            }
+
+            m_widgetsWithPendingGeometrySignals[i] = nullptr;
+            if (widget->m_positionChangePending || widget->m_sizeChangePending)
+                queueGeometrySignals(*widget);
+            else
+                widget->m_geometrySignalsQueued = false;
+        }
+
+        m_widgetsWithPendingGeometrySignals.erase(m_widgetsWithPendingGeometrySignals.begin(), m_widgetsWithPendingGeometrySignals.begin() + queueSize);
+        for (std::size_t i = 0; i < m_widgetsWithPendingGeometrySignals.size(); ++i)
+        {
+            if (m_widgetsWithPendingGeometrySignals[i])
+                m_widgetsWithPendingGeometrySignals[i]->m_geometrySignalsQueueIndex = i;
+        }
+
+        m_emittingGeometrySignals = false;
+        return widgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::scheduleUpdate(Widget& widget, sf::Time delay)
+    {
+        const sf::Time time = m_schedulerTime + std::max(delay, sf::Time::Zero);
+        if (widget.m_updateScheduled)
+        {
+            ScheduledUpdate& entry = m_scheduledUpdates[widget.m_scheduledUpdateIndex];
+            assert(entry.widget == &widget);
+            if (time >= entry.time)
+                return;
+
+            // Move the existing entry forward, this only happens when a widget needs an update sooner than it already requested.
+            // The elapsed time is still measured from the moment the widget started waiting for an update.
+            entry.time = time;
+            entry.order = m_scheduledUpdateCounter++;
+            moveScheduledUpdateUp(widget.m_scheduledUpdateIndex);
+        }
+        else
+        {
+            m_scheduledUpdates.push_back({time, m_scheduledUpdateCounter++, &widget});
+            moveScheduledUpdateUp(m_scheduledUpdates.size() - 1);
+            widget.m_updateScheduled = true;
+            widget.m_lastUpdateTime = m_schedulerTime;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::scheduleVisibleWidgets(Widget& widget)
+    {
+        if (!isVisibleWithParents(widget))
+            return;
+
+        scheduleUpdate(widget, {});
+
+        if (widget.isContainer())
+        {
+            for (const auto& child : static_cast<Container&>(widget).getWidgets())
+                scheduleVisibleWidgets(*child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GuiContainer::updateScheduledWidgets(sf::Time elapsedTime)
+    {
+        m_schedulerTime += elapsedTime;
+
+        // Updates that are scheduled while looping have a higher order and are left for the next call. Since they can't be due
+        // earlier than now, the widgets that were due before the loop started always come first in the heap.
+        const std::uint64_t endOrder = m_scheduledUpdateCounter;
+
+        std::size_t widgetCount = 0;
+        while (!m_scheduledUpdates.empty() && (m_scheduledUpdates.front().time <= m_schedulerTime) && (m_scheduledUpdates.front().order < endOrder))
+        {
+            Widget* widget = m_scheduledUpdates.front().widget;
+            removeScheduledUpdate(0);
+
+            // Hidden widgets aren't updated, just like Container::update skips them, they are scheduled again when they are shown
+            if (!isVisibleWithParents(*widget))
+                continue;
+
+            // Containers that are updated here don't update their children, those have their own entries
+            const sf::Time updateElapsedTime = m_schedulerTime - widget->m_lastUpdateTime;
+            widget->m_lastUpdateTime = m_schedulerTime;
+            m_scheduledWidgetBeingUpdated = widget;
+            widget->update(updateElapsedTime);
+            m_scheduledWidgetBeingUpdated = nullptr;
+            ++widgetCount;
+        }
+
+        return widgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time GuiContainer::getSchedulerTime() const
+    {
+        return m_schedulerTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::widgetDetached(Widget& widget)
+    {
+        if (m_widgetsWithChangedLayouts.empty() && m_widgetsWithPendingGeometrySignals.empty() && m_scheduledUpdates.empty())
+            return;
+
+        if (widget.m_updateScheduled)
+        {
+            assert(m_scheduledUpdates[widget.m_scheduledUpdateIndex].widget == &widget);
+            removeScheduledUpdate(widget.m_scheduledUpdateIndex);
+        }
+
+        if (widget.m_geometrySignalsQueued)
+        {
+            m_widgetsWithPendingGeometrySignals[widget.m_geometrySignalsQueueIndex] = nullptr;
+            widget.m_positionChangePending = false;
+            widget.m_sizeChangePending = false;
+            widget.m_geometrySignalsQueued = false;
+        }
+
+        if (m_widgetsWithChangedLayouts.erase(&widget) > 0)
+            widget.recalculateLayouts();
+
+        const auto* container = dynamic_cast<Container*>(&widget);
+        if (container)
+        {
+            for (const auto& child : container->getWidgets())
+                widgetDetached(*child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,10 +106,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void CustomWidgetForBindings::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        if (parent)
+            scheduleUpdate({});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void CustomWidgetForBindings::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
         implUpdateFunction(elapsedTime);
+
+        // The bindings expect the update function to be called every frame
+        scheduleUpdate({});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/BackgroundConstruction.hpp>
 #include <TGUI/DefaultFont.hpp>
 #include <functional>
 #include <sstream>
@@ -69,6 +70,15 @@ namespace tgui
 
     Font getGlobalFont()
     {
+        // sf::Font caches its glyphs while rendering text, so a thread constructing widgets in the background needs its own font
+        if (BackgroundConstruction* construction = BackgroundConstruction::getActive())
+        {
+            if (!construction->getFont())
+                construction->setFont({defaultFontBytes, sizeof(defaultFontBytes)});
+
+            return construction->getFont();
+        }
+
         if (!globalFont)
         {
             globalFont = std::make_shared<sf::Font>();
@@ -82,6 +92,11 @@ namespace tgui
 
     const std::shared_ptr<sf::Font>& getInternalGlobalFont()
     {
+        // Fonts that are destroyed in the background should never reset the global font of the gui thread
+        static const std::shared_ptr<sf::Font> noFont;
+        if (BackgroundConstruction::getActive())
+            return noFont;
+
         return globalFont;
     }
 
@@ -215,6 +230,21 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t StringHash::operator()(const sf::String& str) const
+    {
+        // FNV-1a hash over the UTF-32 characters, which avoids converting the string first
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const auto c : str)
+        {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+
+        return static_cast<std::size_t>(hash);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,7 +134,7 @@ namespace tgui
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
             for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -153,6 +153,82 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        if (m_mouseMoveCoalescing && ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)))
+        {
+            // A move of a different kind (or of another finger) can't be combined with the move that is already waiting
+            if (m_mouseMovePending
+             && ((m_pendingMouseMove.type != event.type)
+              || ((event.type == sf::Event::TouchMoved) && (m_pendingMouseMove.touch.finger != event.touch.finger))))
+            {
+                processCoalescedMouseMove();
+            }
+
+            if (!m_mouseMovePending)
+                m_coalescedMousePath.clear();
+
+            if (event.type == sf::Event::MouseMoved)
+                m_coalescedMousePath.emplace_back(event.mouseMove.x, event.mouseMove.y);
+            else
+                m_coalescedMousePath.emplace_back(event.touch.x, event.touch.y);
+
+            m_pendingMouseMove = event;
+            m_mouseMovePending = true;
+            return false;
+        }
+
+        // Any other event is handled after the position of the mouse has been updated
+        if (m_mouseMovePending)
+            processCoalescedMouseMove();
+
+        return dispatchEvent(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setMouseMoveCoalescing(bool coalesce)
+    {
+        if (!coalesce && m_mouseMovePending)
+            processCoalescedMouseMove();
+
+        m_mouseMoveCoalescing = coalesce;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isMouseMoveCoalescing() const
+    {
+        return m_mouseMoveCoalescing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::processCoalescedMouseMove()
+    {
+        if (!m_mouseMovePending)
+            return false;
+
+        m_mouseMovePending = false;
+        return dispatchEvent(m_pendingMouseMove);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Vector2f> Gui::getCoalescedMousePath() const
+    {
+        assert(m_target != nullptr);
+
+        std::vector<Vector2f> path;
+        path.reserve(m_coalescedMousePath.size());
+        for (const auto& pixel : m_coalescedMousePath)
+            path.push_back(m_target->mapPixelToCoords(pixel, m_view));
+
+        return path;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::dispatchEvent(sf::Event event)
+    {
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -283,12 +359,21 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // Handle the latest mouse position when mouse moves are coalesced
+        processCoalescedMouseMove();
+
+        // Execute the tasks that other threads posted, before the layouts are recalculated for the changes they made
+        processPostedTasks(m_postedTaskTimeBudget);
+
         // Update the time
         if (m_windowFocused)
             updateTime(m_clock.restart());
         else
             m_clock.restart();
 
+        // Recalculate the layouts that were changed since the last frame and emit the coalesced position and size signals
+        updateLayouts();
+
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
@@ -303,6 +388,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setDeferredLayoutResolution(bool deferred)
+    {
+        m_container->setDeferredLayoutResolution(deferred);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDeferredLayoutResolution() const
+    {
+        return m_container->isDeferredLayoutResolution();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setCoalescedGeometrySignals(bool coalesced)
+    {
+        m_container->setCoalescedGeometrySignals(coalesced);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isCoalescedGeometrySignals() const
+    {
+        return m_container->isCoalescedGeometrySignals();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::updateLayouts()
+    {
+        const std::size_t widgetCount = m_container->resolveDeferredLayouts();
+        m_container->emitCoalescedGeometrySignals();
+        return widgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> task)
+    {
+        m_postedTasks.push(std::move(task));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::processPostedTasks(sf::Time budget)
+    {
+        return m_postedTasks.process(budget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setPostedTaskTimeBudget(sf::Time budget)
+    {
+        m_postedTaskTimeBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getPostedTaskTimeBudget() const
+    {
+        return m_postedTaskTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -460,7 +610,9 @@ namespace tgui
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_container->m_animationTimeElapsed = elapsedTime;
-        m_container->update(elapsedTime);
+
+        // Only the widgets that requested an update are updated, instead of every widget in the gui
+        m_container->updateScheduledWidgets(elapsedTime);
 
         if (m_tooltipPossible)
         {
@@ -29,11 +29,31 @@
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
+#include <unordered_map>
+#include <unordered_set>
+#include <list>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Parsed layout strings, so that loading many widgets with the same layouts doesn't parse the same strings over and over.
+        // Every thread has its own cache so that no lock is needed. When the cache is full, the string that wasn't used for the
+        // longest time is removed.
+        struct ParsedExpressionCache
+        {
+            std::list<std::pair<std::string, Layout>> entries; // Most recently used string first
+            std::unordered_map<std::string, std::list<std::pair<std::string, Layout>>::iterator> lookup;
+        };
+
+        const std::size_t maxParsedExpressions = 1000;
+        thread_local ParsedExpressionCache parsedExpressions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     static std::pair<std::string, std::string> parseMinMaxExpresssion(const std::string& expression)
     {
         unsigned int bracketCount = 0;
@@ -66,10 +86,279 @@ namespace tgui
 
     Layout::Layout(std::string expression)
     {
+        auto& cache = parsedExpressions;
+        const auto lookupIt = cache.lookup.find(expression);
+        if (lookupIt != cache.lookup.end())
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, lookupIt->second);
+            *this = lookupIt->second->second;
+            return;
+        }
+
+        Layout layout = parse(expression);
+        while (cache.lookup.size() >= maxParsedExpressions)
+        {
+            cache.lookup.erase(cache.entries.back().first);
+            cache.entries.pop_back();
+        }
+
+        cache.entries.emplace_front(expression, std::move(layout));
+        cache.lookup.emplace(std::move(expression), cache.entries.begin());
+        *this = cache.entries.front().second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, Widget* boundWidget)
+    {
+        assert((operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight));
+        assert(boundWidget != nullptr);
+
+        // All layouts that only bind a widget share the same program
+        static const auto bindingProgram = std::make_shared<const Program>(Program{{{Operation::BindingString, 0, 0}}, {""}, 1, false});
+        m_program = bindingProgram;
+
+        Binding binding;
+        binding.operation = operation;
+        binding.widget = boundWidget;
+        if ((operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight))
+            binding.container = dynamic_cast<Container*>(boundWidget);
+
+        m_bindings.push_back(binding);
+
+        resetPointers();
+        calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, Layout leftOperand, Layout rightOperand)
+    {
+        assert((operation == Operation::Plus) || (operation == Operation::Minus)
+               || (operation == Operation::Multiplies) || (operation == Operation::Divides)
+               || (operation == Operation::Minimum) || (operation == Operation::Maximum));
+
+        auto program = std::make_shared<Program>();
+        auto appendOperand = [this,&program](const Layout& operand)
+            {
+                if (!operand.m_program)
+                {
+                    program->instructions.push_back({Operation::Value, operand.m_value, 0});
+                    return;
+                }
+
+                const std::size_t bindingOffset = m_bindings.size();
+                for (const auto& instruction : operand.m_program->instructions)
+                {
+                    program->instructions.push_back(instruction);
+                    if (instruction.operation == Operation::BindingString)
+                        program->instructions.back().binding += bindingOffset;
+                }
+
+                program->bindingStrings.insert(program->bindingStrings.end(), operand.m_program->bindingStrings.begin(), operand.m_program->bindingStrings.end());
+                program->hasBindingStrings = program->hasBindingStrings || operand.m_program->hasBindingStrings;
+                m_bindings.insert(m_bindings.end(), operand.m_bindings.begin(), operand.m_bindings.end());
+            };
+
+        appendOperand(leftOperand);
+        appendOperand(rightOperand);
+        program->instructions.push_back({operation, 0, 0});
+
+        // The right operand is evaluated while the result of the left operand is still on the stack
+        const std::size_t leftStackSize = leftOperand.m_program ? leftOperand.m_program->stackSize : 1;
+        const std::size_t rightStackSize = rightOperand.m_program ? rightOperand.m_program->stackSize : 1;
+        program->stackSize = std::max(leftStackSize, rightStackSize + 1);
+
+        m_program = std::move(program);
+        resetPointers();
+        calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(const Layout& other) :
+        m_value   {other.m_value},
+        m_program {other.m_program},
+        m_bindings{other.m_bindings}
+    {
+        // Disconnect the bound widgets if a string was used, the same name may apply to a different widget now
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
+        {
+            if (!m_program->bindingStrings[i].empty())
+                m_bindings[i] = {Operation::BindingString, nullptr, nullptr, m_bindings[i].value};
+        }
+
+        resetPointers();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Layout&& other) :
+        m_value{other.m_value}
+    {
+        // The bound widgets still refer to the other layout, it won't be able to unbind them once its bindings are taken
+        other.unbindLayout();
+
+        m_program = std::move(other.m_program);
+        m_bindings = std::move(other.m_bindings);
+        other.m_bindings.clear();
+
+        resetPointers();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout& Layout::operator=(const Layout& other)
+    {
+        if (this != &other)
+        {
+            Layout temp{other};
+            *this = std::move(temp);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout& Layout::operator=(Layout&& other)
+    {
+        if (this != &other)
+        {
+            unbindLayout();
+            other.unbindLayout();
+
+            m_value    = other.m_value;
+            m_program  = std::move(other.m_program);
+            m_bindings = std::move(other.m_bindings);
+            other.m_bindings.clear();
+
+            resetPointers();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::~Layout()
+    {
+        unbindLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Layout::toString() const
+    {
+        if (!m_program)
+            return to_string(m_value);
+
+        // Rebuild the expression from the instructions, using the same brackets as the expression would have as a tree
+        struct Term
+        {
+            std::string text;
+            Operation operation;
+            float value;
+            bool percentage; // A constant multiplied with the inner size of the parent, which is written as a percentage
+        };
+
+        auto needsBrackets = [](const Term& term)
+            {
+                if ((term.operation != Operation::Plus) && (term.operation != Operation::Minus)
+                 && (term.operation != Operation::Multiplies) && (term.operation != Operation::Divides))
+                    return false;
+
+                return !term.percentage;
+            };
+
+        std::vector<Term> terms;
+        for (const auto& instruction : m_program->instructions)
+        {
+            if (instruction.operation == Operation::Value)
+            {
+                terms.push_back({to_string(instruction.value), Operation::Value, instruction.value, false});
+                continue;
+            }
+            else if (instruction.operation == Operation::BindingString)
+            {
+                // Hopefully the expression is stored in the binding string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+                const std::string& bindingString = m_program->bindingStrings[instruction.binding];
+                terms.push_back({(bindingString == "&.innersize") ? "100%" : bindingString, Operation::BindingString, 0, false});
+                continue;
+            }
+
+            assert(terms.size() >= 2);
+            const Term right = std::move(terms.back());
+            terms.pop_back();
+            const Term left = std::move(terms.back());
+            terms.pop_back();
+
+            if (instruction.operation == Operation::Minimum)
+            {
+                terms.push_back({"min(" + left.text + ", " + right.text + ")", instruction.operation, 0, false});
+                continue;
+            }
+            else if (instruction.operation == Operation::Maximum)
+            {
+                terms.push_back({"max(" + left.text + ", " + right.text + ")", instruction.operation, 0, false});
+                continue;
+            }
+
+            char operatorChar;
+            if (instruction.operation == Operation::Plus)
+                operatorChar = '+';
+            else if (instruction.operation == Operation::Minus)
+                operatorChar = '-';
+            else if (instruction.operation == Operation::Multiplies)
+                operatorChar = '*';
+            else // if (instruction.operation == Operation::Divides)
+                operatorChar = '/';
+
+            const bool percentage = (instruction.operation == Operation::Multiplies) && (left.operation == Operation::Value) && (right.text == "100%");
+
+            std::string text;
+            if (needsBrackets(left) && needsBrackets(right))
+                text = "(" + left.text + ") " + operatorChar + " (" + right.text + ")";
+            else if (needsBrackets(left))
+                text = "(" + left.text + ") " + operatorChar + " " + right.text;
+            else if (needsBrackets(right))
+                text = left.text + " " + operatorChar + " (" + right.text + ")";
+            else if (percentage)
+                text = to_string(left.value * 100) + '%';
+            else
+                text = left.text + " " + operatorChar + " " + right.text;
+
+            terms.push_back({std::move(text), instruction.operation, 0, percentage});
+        }
+
+        assert(terms.size() == 1);
+        return terms.back().text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout Layout::parse(std::string expression)
+    {
+        // We can't search for the referenced widget yet as no widget is connected to the layout yet, so store the string for future parsing
+        auto createBindingString = [](std::string bindingString)
+            {
+                auto program = std::make_shared<Program>();
+                program->instructions.push_back({Operation::BindingString, 0, 0});
+                program->bindingStrings.push_back(std::move(bindingString));
+                program->hasBindingStrings = true;
+
+                Layout layout;
+                layout.m_program = std::move(program);
+                layout.m_bindings.emplace_back();
+                return layout;
+            };
+
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
         expression = trim(expression);
         if (expression.empty())
-            return;
+            return {};
 
         auto searchPos = expression.find_first_of("+-/*()");
 
@@ -81,15 +370,12 @@ namespace tgui
             {
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
-                {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
-                }
+                    return createBindingString("&.innersize");
                 else // value is a fraction of parent size
                 {
-                    *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f),
-                                   std::make_unique<Layout>("&.innersize")};
+                    return Layout{Operation::Multiplies,
+                                  tgui::stof(expression.substr(0, expression.length()-1)) / 100.f,
+                                  createBindingString("&.innersize")};
                 }
             }
             else
@@ -113,27 +399,23 @@ namespace tgui
                  || (expression.size() >= 10 && expression.substr(expression.size()-10) == "innerwidth")
                  || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
                 {
-                    // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    return createBindingString(expression);
                 }
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
+                    return Layout{Operation::Plus,
+                                  createBindingString(expression.substr(0, expression.size()-5) + "left"),
+                                  createBindingString(expression.substr(0, expression.size()-5) + "width")};
                 }
                 else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
                 {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "height")};
+                    return Layout{Operation::Plus,
+                                  createBindingString(expression.substr(0, expression.size()-6) + "top"),
+                                  createBindingString(expression.substr(0, expression.size()-6) + "height")};
                 }
                 else // Constant value
-                    m_value = tgui::stof(expression);
+                    return tgui::stof(expression);
             }
-
-            return;
         }
 
         // The string contains an expression, so split it up in multiple layouts
@@ -146,19 +428,19 @@ namespace tgui
             {
             case '+':
                 operators.push_back(Operation::Plus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '-':
                 operators.push_back(Operation::Minus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '*':
                 operators.push_back(Operation::Multiplies);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '/':
                 operators.push_back(Operation::Divides);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '(':
             {
@@ -176,20 +458,17 @@ namespace tgui
                         // If the entire layout was in brackets then remove these brackets
                         if ((searchPos == 0) && (bracketPos == expression.size()-1))
                         {
-                            *this = Layout{expression.substr(1, expression.size()-2)};
-                            return;
+                            return parse(expression.substr(1, expression.size()-2));
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "min"))
                         {
                             const auto& minSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Minimum, std::make_unique<Layout>(minSubExpressions.first), std::make_unique<Layout>(minSubExpressions.second)};
-                            return;
+                            return Layout{Operation::Minimum, parse(minSubExpressions.first), parse(minSubExpressions.second)};
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "max"))
                         {
                             const auto& maxSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Maximum, std::make_unique<Layout>(maxSubExpressions.first), std::make_unique<Layout>(maxSubExpressions.second)};
-                            return;
+                            return Layout{Operation::Maximum, parse(maxSubExpressions.first), parse(maxSubExpressions.second)};
                         }
                         else // The brackets form a sub-expression
                             searchPos = bracketPos;
@@ -203,7 +482,7 @@ namespace tgui
                 if (bracketPos == std::string::npos)
                 {
                     TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                    return;
+                    return {};
                 }
                 else
                 {
@@ -214,7 +493,7 @@ namespace tgui
             }
             case ')':
                 TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                return;
+                return {};
             };
 
             prevSearchPos = searchPos + 1;
@@ -225,10 +504,10 @@ namespace tgui
         {
             // We would get an infinite loop if we don't abort in this condition
             TGUI_PRINT_WARNING("error in expression '" << expression << "'.");
-            return;
+            return {};
         }
 
-        operands.emplace_back(expression.substr(prevSearchPos));
+        operands.push_back(parse(expression.substr(prevSearchPos)));
 
         // First perform all * and / operations
         auto operandIt = operands.begin();
@@ -239,9 +518,7 @@ namespace tgui
                 auto nextOperandIt = operandIt;
                 std::advance(nextOperandIt, 1);
 
-                (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                (*operandIt) = Layout{operators[i], std::move(*operandIt), std::move(*nextOperandIt)};
 
                 operands.erase(nextOperandIt);
             }
@@ -263,18 +540,16 @@ namespace tgui
                 assert(nextOperandIt != operands.end());
 
                 // Handle unary plus or minus
-                if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+                if (operandIt->isConstant() && nextOperandIt->isConstant() && (operandIt->m_value == 0))
                 {
                     if (operators[i] == Operation::Minus)
                         nextOperandIt->m_value = -nextOperandIt->m_value;
 
-                    *operandIt = *nextOperandIt;
+                    *operandIt = std::move(*nextOperandIt);
                 }
                 else // Normal addition or subtraction
                 {
-                    *operandIt = Layout{operators[i],
-                                        std::make_unique<Layout>(*operandIt),
-                                        std::make_unique<Layout>(*nextOperandIt)};
+                    *operandIt = Layout{operators[i], std::move(*operandIt), std::move(*nextOperandIt)};
                 }
 
                 operands.erase(nextOperandIt);
@@ -282,438 +557,372 @@ namespace tgui
         }
 
         assert(operands.size() == 1);
-        *this = operands.front();
+        return std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    void Layout::unbindLayout()
     {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-        assert(m_boundWidget != nullptr);
-
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
+        for (const auto& binding : m_bindings)
         {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
+            if (!binding.widget)
+                continue;
 
-        resetPointers();
-        recalculateValue();
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->unbindPositionLayout(this);
+            else
+                binding.widget->unbindSizeLayout(this);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    void Layout::resetPointers()
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
-        resetPointers();
-        recalculateValue();
-    }
+        for (const auto& binding : m_bindings)
+        {
+            if (!binding.widget)
+                continue;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            assert((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop)
+                   || (binding.operation == Operation::BindingWidth) || (binding.operation == Operation::BindingHeight)
+                   || (binding.operation == Operation::BindingInnerWidth) || (binding.operation == Operation::BindingInnerHeight));
 
-    Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
-    {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
-        resetPointers();
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->bindPositionLayout(this);
+            else
+                binding.widget->bindSizeLayout(this);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
     {
-        resetPointers();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const float oldValue = m_value;
 
-    Layout& Layout::operator=(const Layout& other)
-    {
-        if (this != &other)
+        // Parse the string bindings even when the referred widgets were already found. The widget may be added to a different parent
+        if (m_program && m_program->hasBindingStrings)
         {
             unbindLayout();
 
-            m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
-
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
+            for (std::size_t i = 0; i < m_bindings.size(); ++i)
+            {
+                if (!m_program->bindingStrings[i].empty())
+                    parseBindingString(m_bindings[i], m_program->bindingStrings[i], widget, xAxis);
+            }
 
             resetPointers();
+            calculateValue();
         }
 
-        return *this;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        m_connectedWidgetCallback = valueChangedCallbackHandler;
+        m_connectedWidget = widget;
 
-    Layout& Layout::operator=(Layout&& other)
-    {
-        if (this != &other)
+        if (m_value != oldValue)
         {
-            unbindLayout();
-
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
-
-            resetPointers();
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
         }
-
-        return *this;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::~Layout()
+    void Layout::unbindWidget(Widget* widget)
     {
-        unbindLayout();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        if (!m_program)
+            return;
 
-    std::string Layout::toString() const
-    {
-        if (m_operation == Operation::Value)
-        {
-            return to_string(m_value);
-        }
-        else if (m_operation == Operation::Minimum)
-        {
-            return "min(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
-        }
-        else if (m_operation == Operation::Maximum)
-        {
-            return "max(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
-        }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
+        // The widget is being destroyed, so it isn't unbound from the widget. Bindings that were created from a string keep the
+        // last value of the widget (until the name is found again), while other bindings to the widget are replaced by 0.
+        // The value of the layout only changes when it is recalculated for a different reason, except for a layout that only
+        // bound the widget, which immediately becomes the constant 0.
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
+            if (m_bindings[i].widget != widget)
+                continue;
 
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
-                {
-                    if (!operand->m_leftOperand)
-                        return false;
-
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
-                        return false;
-
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == "100%"))
-                        return false;
-
-                    return true;
-                };
-
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
+            if (!m_program->bindingStrings[i].empty())
+                m_bindings[i] = {Operation::BindingString, nullptr, nullptr, m_bindings[i].value};
             else
-            {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == "100%"))
-                    return to_string(m_leftOperand->getValue() * 100) + '%';
-                else
-                    return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
-            }
+                m_bindings[i] = {Operation::Value, nullptr, nullptr, 0};
         }
-        else
-        {
-            if (m_boundString == "&.innersize")
-                return "100%";
 
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
+        // A layout that only bound the widget becomes a constant
+        if ((m_program->instructions.size() == 1) && (m_bindings.size() == 1) && (m_bindings[0].operation == Operation::Value))
+        {
+            m_program = nullptr;
+            m_bindings.clear();
+            m_value = 0;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindLayout()
+    void Layout::recalculateValue()
     {
-        if (m_boundWidget)
-        {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+        const float oldValue = m_value;
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
-            else
-                m_boundWidget->unbindSizeLayout(this);
+        calculateValue();
+
+        if (m_value != oldValue)
+        {
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::boundWidgetChanged()
     {
-        if (m_leftOperand != nullptr)
+        if (m_connectedWidget)
         {
-            assert(m_rightOperand != nullptr);
-
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
+            // Widgets that aren't part of a gui (e.g. the ones created by a BackgroundConstruction) are always updated directly
+            GuiContainer* guiContainer = m_connectedWidget->getGuiContainer();
+            if (guiContainer && guiContainer->isDeferredLayoutResolution())
+            {
+                guiContainer->addWidgetWithChangedLayouts(m_connectedWidget);
+                return;
+            }
         }
 
-        if (m_boundWidget)
-        {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
-            else
-                m_boundWidget->bindSizeLayout(this);
-        }
+        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    void Layout::calculateValue()
     {
-        const float oldValue = m_value;
-
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
-
-        parseBindingStringRecursive(widget, xAxis);
-
-        // Restore the callback function
-        m_connectedWidgetCallback = valueChangedCallbackHandler;
+        if (!m_program)
+            return;
 
-        if (m_value != oldValue)
+        // Most expressions only need a few values on the stack, so only allocate memory for the longest ones
+        float stackBuffer[16];
+        std::vector<float> heapStack;
+        float* stack = stackBuffer;
+        if (m_program->stackSize > 16)
         {
-            if (m_connectedWidgetCallback)
-                m_connectedWidgetCallback();
+            heapStack.resize(m_program->stackSize);
+            stack = heapStack.data();
         }
-    }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Layout::unbindWidget()
-    {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        std::size_t top = 0;
+        for (const auto& instruction : m_program->instructions)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            switch (instruction.operation)
+            {
+                case Operation::Value:
+                    stack[top++] = instruction.value;
+                    break;
+                case Operation::BindingString:
+                {
+                    // The bindings that aren't bound (e.g. because the referred widget wasn't found yet) keep their last value
+                    auto& binding = m_bindings[instruction.binding];
+                    switch (binding.operation)
+                    {
+                        case Operation::BindingLeft:
+                            binding.value = binding.widget->getPosition().x;
+                            break;
+                        case Operation::BindingTop:
+                            binding.value = binding.widget->getPosition().y;
+                            break;
+                        case Operation::BindingWidth:
+                            binding.value = binding.widget->getSize().x;
+                            break;
+                        case Operation::BindingHeight:
+                            binding.value = binding.widget->getSize().y;
+                            break;
+                        case Operation::BindingInnerWidth:
+                            if (binding.container)
+                                binding.value = binding.container->getInnerSize().x;
+                            break;
+                        case Operation::BindingInnerHeight:
+                            if (binding.container)
+                                binding.value = binding.container->getInnerSize().y;
+                            break;
+                        default:
+                            break;
+                    };
+
+                    stack[top++] = binding.value;
+                    break;
+                }
+                case Operation::Plus:
+                    --top;
+                    stack[top-1] = stack[top-1] + stack[top];
+                    break;
+                case Operation::Minus:
+                    --top;
+                    stack[top-1] = stack[top-1] - stack[top];
+                    break;
+                case Operation::Multiplies:
+                    --top;
+                    stack[top-1] = stack[top-1] * stack[top];
+                    break;
+                case Operation::Divides:
+                    --top;
+                    if (stack[top] != 0)
+                        stack[top-1] = stack[top-1] / stack[top];
+                    else
+                        stack[top-1] = 0;
+                    break;
+                case Operation::Minimum:
+                    --top;
+                    stack[top-1] = std::min(stack[top-1], stack[top]);
+                    break;
+                case Operation::Maximum:
+                    --top;
+                    stack[top-1] = std::max(stack[top-1], stack[top]);
+                    break;
+                default:
+                    assert(false);
+                    break;
+            };
         }
 
-        recalculateValue();
+        assert(top == 1);
+        m_value = stack[0];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::recalculateValue()
+    std::size_t Layout::resolveDeferredLayouts(std::unordered_set<Widget*>& widgetsWithChangedLayouts)
     {
-        const float oldValue = m_value;
+        if (widgetsWithChangedLayouts.empty())
+            return 0;
 
-        switch (m_operation)
+        std::size_t evaluationCount = 0;
+        std::unordered_set<Widget*> evaluatedWidgets;
+        while (true)
         {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
+            // Start with the marked widgets that weren't recalculated yet. A widget that gets marked again after it was
+            // recalculated (e.g. because it is part of a cycle) will only be recalculated during the next call.
+            std::vector<Widget*> widgets;
+            std::unordered_map<Widget*, std::size_t> widgetIndices;
+            for (Widget* widget : widgetsWithChangedLayouts)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
+                if (evaluatedWidgets.count(widget) == 0)
+                {
+                    widgetIndices[widget] = widgets.size();
+                    widgets.push_back(widget);
+                }
+            }
+
+            if (widgets.empty())
                 break;
+
+            // Add all widgets that directly or indirectly depend on them, as they may have to be recalculated as well
+            std::vector<std::vector<std::size_t>> dependents;
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                dependents.emplace_back();
+                for (const auto* boundLayouts : {&widgets[i]->m_boundPositionLayouts, &widgets[i]->m_boundSizeLayouts})
+                {
+                    for (const Layout* layout : *boundLayouts)
+                    {
+                        Widget* dependent = layout->m_connectedWidget;
+                        if (!dependent)
+                            continue;
+
+                        const auto result = widgetIndices.emplace(dependent, widgets.size());
+                        if (result.second)
+                            widgets.push_back(dependent);
+
+                        dependents[i].push_back(result.first->second);
+                    }
+                }
             }
-            case Operation::BindingInnerHeight:
+
+            // Sort the widgets so that each widget comes after all the widgets on which it depends
+            std::vector<std::size_t> dependencyCounts(widgets.size(), 0);
+            for (const auto& widgetDependents : dependents)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
+                for (const std::size_t dependent : widgetDependents)
+                    ++dependencyCounts[dependent];
             }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
-        };
 
-        if (m_value != oldValue)
-        {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            std::vector<std::size_t> order;
+            order.reserve(widgets.size());
+            for (std::size_t i = 0; i < widgets.size(); ++i)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                if (dependencyCounts[i] == 0)
+                    order.push_back(i);
             }
-        }
-    }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            for (std::size_t i = 0; i < order.size(); ++i)
+            {
+                for (const std::size_t dependent : dependents[order[i]])
+                {
+                    if (--dependencyCounts[dependent] == 0)
+                        order.push_back(dependent);
+                }
+            }
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
-    {
-        if (m_leftOperand)
-        {
-            assert(m_rightOperand != nullptr);
+            if (order.size() < widgets.size())
+            {
+                TGUI_PRINT_WARNING("cycle detected while resolving layouts, " << (widgets.size() - order.size()) << " widgets depend on each other.");
+                for (std::size_t i = 0; i < widgets.size(); ++i)
+                {
+                    if (dependencyCounts[i] > 0)
+                        order.push_back(i);
+                }
+            }
+
+            // Recalculate the widgets that are marked. Recalculating a widget may mark widgets that come later in the order.
+            for (const std::size_t index : order)
+            {
+                Widget* widget = widgets[index];
+                if ((evaluatedWidgets.count(widget) > 0) || (widgetsWithChangedLayouts.erase(widget) == 0))
+                    continue;
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+                evaluatedWidgets.insert(widget);
+                ++evaluationCount;
+                widget->recalculateLayouts();
+            }
         }
 
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+        return evaluationCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    void Layout::parseBindingString(Binding& binding, const std::string& expression, Widget* widget, bool xAxis)
     {
+        Operation operation;
         if (expression == "x" || expression == "left")
-        {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
-        }
+            operation = Operation::BindingLeft;
         else if (expression == "y" || expression == "top")
-        {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
-        }
+            operation = Operation::BindingTop;
         else if (expression == "w" || expression == "width")
-        {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
-        }
+            operation = Operation::BindingWidth;
         else if (expression == "h" || expression == "height")
-        {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
-        }
+            operation = Operation::BindingHeight;
         else if (expression == "iw" || expression == "innerwidth")
-        {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
-        }
+            operation = Operation::BindingInnerWidth;
         else if (expression == "ih" || expression == "innerheight")
-        {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
-        }
+            operation = Operation::BindingInnerHeight;
         else if (expression == "size")
         {
             if (xAxis)
-                return parseBindingString("width", widget, xAxis);
+                return parseBindingString(binding, "width", widget, xAxis);
             else
-                return parseBindingString("height", widget, xAxis);
+                return parseBindingString(binding, "height", widget, xAxis);
         }
         else if (expression == "innersize")
         {
             if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
+                return parseBindingString(binding, "innerwidth", widget, xAxis);
             else
-                return parseBindingString("innerheight", widget, xAxis);
+                return parseBindingString(binding, "innerheight", widget, xAxis);
         }
         else if ((expression == "pos") || (expression == "position"))
         {
             if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+                return parseBindingString(binding, "x", widget, xAxis);
             else
-                return parseBindingString("y", widget, xAxis);
+                return parseBindingString(binding, "y", widget, xAxis);
         }
         else
         {
@@ -724,7 +933,7 @@ namespace tgui
                 if (widgetName == "parent" || widgetName == "&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(binding, expression.substr(dotPos+1), widget->getParent(), xAxis);
                 }
                 else if (!widgetName.empty())
                 {
@@ -737,7 +946,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(binding, expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
 
@@ -749,7 +958,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(binding, expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
                 }
@@ -759,8 +968,12 @@ namespace tgui
             return;
         }
 
-        resetPointers();
-        recalculateValue();
+        binding.operation = operation;
+        binding.widget = widget;
+        if ((operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight))
+            binding.container = dynamic_cast<Container*>(widget);
+        else
+            binding.container = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -768,35 +981,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -879,8 +1092,8 @@ namespace tgui
         Layout bindRight(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          Layout{Layout::Operation::BindingLeft, widget.get()},
+                          Layout{Layout::Operation::BindingWidth, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -888,8 +1101,8 @@ namespace tgui
         Layout bindBottom(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          Layout{Layout::Operation::BindingTop, widget.get()},
+                          Layout{Layout::Operation::BindingHeight, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -931,14 +1144,14 @@ namespace tgui
 
         Layout bindMin(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Minimum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Minimum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindMax(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Maximum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Maximum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,10 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/BackgroundConstruction.hpp>
+#include <shared_mutex>
+#include <mutex>
+#include <cstdint>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -264,11 +268,21 @@ namespace tgui
                };
             }
         };
+
+        std::mutex defaultThemeMutex; // Prevents multiple threads from resetting the built-in default theme at the same time
+
+        // The renderers of a theme are mostly read, so readers don't block each other. Instead of storing a mutex inside each
+        // theme, which would make themes non-copyable, a theme uses the mutex that is selected based on its address.
+        std::shared_timed_mutex& getRendererMutex(const Theme* theme)
+        {
+            static std::shared_timed_mutex rendererMutexes[16];
+            return rendererMutexes[(reinterpret_cast<std::uintptr_t>(theme) >> 4) % 16];
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Theme* Theme::m_defaultTheme = nullptr;
+    std::atomic<Theme*> Theme::m_defaultTheme{nullptr};
     std::shared_ptr<BaseThemeLoader> Theme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,8 +298,8 @@ namespace tgui
 
     Theme::~Theme()
     {
-        if (m_defaultTheme == this)
-            setDefault(nullptr);
+        Theme* self = this;
+        m_defaultTheme.compare_exchange_strong(self, nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,16 +377,21 @@ namespace tgui
         std::string lowercaseSecondary = toLower(id);
 
         // If we already have this renderer in cache then just return it
-        auto it = m_renderers.find(lowercaseSecondary);
-        if (it != m_renderers.end())
-            return it->second;
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(getRendererMutex(this));
+            auto it = m_renderers.find(lowercaseSecondary);
+            if (it != m_renderers.end())
+                return it->second;
+        }
 
-        m_renderers[lowercaseSecondary] = RendererData::create();
+        auto renderer = RendererData::create();
         auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
         for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
 
-        return m_renderers[lowercaseSecondary];
+        // If another thread added the same renderer in the meantime then the one that was added first is kept
+        std::lock_guard<std::shared_timed_mutex> lock(getRendererMutex(this));
+        return m_renderers.emplace(lowercaseSecondary, renderer).first->second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,26 +401,36 @@ namespace tgui
         std::string lowercaseSecondary = toLower(id);
 
         // If we already have this renderer in cache then just return it
-        auto it = m_renderers.find(lowercaseSecondary);
-        if (it != m_renderers.end())
-            return it->second;
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(getRendererMutex(this));
+            auto it = m_renderers.find(lowercaseSecondary);
+            if (it != m_renderers.end())
+                return it->second;
+        }
 
-        m_renderers[lowercaseSecondary] = RendererData::create();
+        auto renderer = RendererData::create();
+        const bool canLoad = m_themeLoader->canLoad(m_primary, lowercaseSecondary);
+        if (canLoad)
+        {
+            auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
+            for (const auto& property : properties)
+                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        }
 
-        if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
+        // If another thread added the same renderer in the meantime then the one that was added first is kept
+        std::lock_guard<std::shared_timed_mutex> lock(getRendererMutex(this));
+        const auto& storedRenderer = m_renderers.emplace(lowercaseSecondary, renderer).first->second;
+        if (!canLoad)
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[lowercaseSecondary];
+        return storedRenderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Theme::addRenderer(const std::string& id, std::shared_ptr<RendererData> renderer)
     {
+        std::lock_guard<std::shared_timed_mutex> lock(getRendererMutex(this));
         m_renderers[toLower(id)] = renderer;
     }
 
@@ -409,6 +438,7 @@ namespace tgui
 
     bool Theme::removeRenderer(const std::string& id)
     {
+        std::lock_guard<std::shared_timed_mutex> lock(getRendererMutex(this));
         auto it = m_renderers.find(toLower(id));
         if (it != m_renderers.end())
         {
@@ -451,10 +481,32 @@ namespace tgui
 
     Theme* Theme::getDefault()
     {
+        // Widgets that are constructed in the background may not share renderers with the widgets of the gui thread
+        if (BackgroundConstruction* construction = BackgroundConstruction::getActive())
+        {
+            if (!construction->getTheme())
+            {
+                auto theme = std::make_shared<DefaultTheme>();
+                theme->reset();
+                construction->setTheme(theme);
+            }
+
+            return construction->getTheme().get();
+        }
+
+        Theme* theme = m_defaultTheme;
+        if (theme)
+            return theme;
+
+        std::lock_guard<std::mutex> lock(defaultThemeMutex);
         if (!m_defaultTheme)
         {
             static DefaultTheme defaultTheme;
-            defaultTheme.reset();
+            {
+                std::lock_guard<std::shared_timed_mutex> rendererLock(getRendererMutex(&defaultTheme));
+                defaultTheme.reset();
+            }
+
             m_defaultTheme = &defaultTheme;
         }
 
@@ -32,6 +32,8 @@
 #include <sstream>
 #include <fstream>
 #include <set>
+#include <mutex>
+#include <shared_mutex>
 
 #ifdef SFML_SYSTEM_ANDROID
     #include <SFML/System/NativeActivity.hpp>
@@ -58,6 +60,9 @@ namespace tgui
 
     namespace
     {
+        // Themes may be loaded from multiple threads. The cache is mostly read, so readers don't block each other.
+        std::shared_timed_mutex propertiesCacheMutex;
+
         // Turns texture and font filenames into paths relative to the theme file
         void injectThemePath(std::set<const DataIO::Node*>& handledSections, const std::unique_ptr<DataIO::Node>& node, const std::string& path)
         {
@@ -145,6 +150,8 @@ namespace tgui
 
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
+        std::lock_guard<std::shared_timed_mutex> lock(propertiesCacheMutex);
+
         if (filename != "")
         {
             auto propertiesCacheIt = m_propertiesCache.find(filename);
@@ -165,55 +172,67 @@ namespace tgui
             return;
 
         // Load the file when not already in cache
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
         {
-            std::string resourcePath;
-            auto slashPos = filename.find_last_of("/\\");
-            if (slashPos != std::string::npos)
-                resourcePath = filename.substr(0, slashPos+1);
+            std::shared_lock<std::shared_timed_mutex> lock(propertiesCacheMutex);
+            if (m_propertiesCache.find(filename) != m_propertiesCache.end())
+                return;
+        }
 
-            std::stringstream fileContents;
-            readFile(filename, fileContents);
+        // The file is parsed without holding the lock, so that other threads can keep using the cache in the meantime
+        std::string resourcePath;
+        auto slashPos = filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            resourcePath = filename.substr(0, slashPos+1);
 
-            std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
+        std::stringstream fileContents;
+        readFile(filename, fileContents);
 
-            if (root->propertyValuePairs.size() != 0)
-                throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
+        std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
 
-            // Turn texture and font filenames into paths relative to the theme file
-            if (!resourcePath.empty())
-            {
-                std::set<const DataIO::Node*> handledSections;
-                injectThemePath(handledSections, root, resourcePath);
-            }
+        if (root->propertyValuePairs.size() != 0)
+            throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
 
-            // Get a list of section names and map them to their nodes (needed for resolving references)
-            std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
-            for (const auto& child : root->children)
-            {
-                std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
-                sections.emplace(name, std::cref(child));
-            }
+        // Turn texture and font filenames into paths relative to the theme file
+        if (!resourcePath.empty())
+        {
+            std::set<const DataIO::Node*> handledSections;
+            injectThemePath(handledSections, root, resourcePath);
+        }
 
-            // Resolve references to sections
-            resolveReferences(sections, root);
+        // Get a list of section names and map them to their nodes (needed for resolving references)
+        std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+        for (const auto& child : root->children)
+        {
+            std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
+            sections.emplace(name, std::cref(child));
+        }
 
-            // Cache all propery value pairs
-            for (const auto& section : sections)
-            {
-                const auto& child = section.second;
-                const std::string& name = section.first;
-                for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][toLower(pair.first)] = pair.second->value;
+        // Resolve references to sections
+        resolveReferences(sections, root);
 
-                for (const auto& nestedProperty : child.get()->children)
-                {
-                    std::stringstream ss;
-                    DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
-                }
+        // Collect all propery value pairs
+        std::map<std::string, std::map<sf::String, sf::String>> properties;
+        for (const auto& section : sections)
+        {
+            const auto& child = section.second;
+            const std::string& name = section.first;
+            for (const auto& pair : child.get()->propertyValuePairs)
+                properties[name][toLower(pair.first)] = pair.second->value;
+
+            for (const auto& nestedProperty : child.get()->children)
+            {
+                std::stringstream ss;
+                DataIO::emit(nestedProperty, ss);
+                properties[name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
             }
         }
+
+        // Cache the properties, unless another thread already loaded the same file while we were parsing it
+        if (!properties.empty())
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(propertiesCacheMutex);
+            m_propertiesCache.emplace(filename, std::move(properties));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,14 +243,27 @@ namespace tgui
 
         const std::string lowercaseClassName = toLower(section);
 
+        // References to elements in the cache stay valid while other elements are added, so they can be returned without lock
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(propertiesCacheMutex);
+
+            const auto fileIt = m_propertiesCache.find(filename);
+            if (fileIt != m_propertiesCache.end())
+            {
+                const auto sectionIt = fileIt->second.find(lowercaseClassName);
+                if (sectionIt != fileIt->second.end())
+                    return sectionIt->second;
+            }
+        }
+
         // An empty filename is not considered an error and will result in an empty property list
         if (filename.empty())
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(propertiesCacheMutex);
             return m_propertiesCache[""][lowercaseClassName];
+        }
 
-        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
-            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
-
-        return m_propertiesCache[filename][lowercaseClassName];
+        throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,8 +272,10 @@ namespace tgui
     {
         if (filename.empty())
             return true;
-        else
-            return m_propertiesCache[filename].find(toLower(section)) != m_propertiesCache[filename].end();
+
+        std::shared_lock<std::shared_timed_mutex> lock(propertiesCacheMutex);
+        const auto fileIt = m_propertiesCache.find(filename);
+        return (fileIt != m_propertiesCache.end()) && (fileIt->second.find(toLower(section)) != fileIt->second.end());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/FlexLayout.hpp>
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/Widgets/Group.hpp>
 #include <TGUI/Widgets/HorizontalLayout.hpp>
@@ -56,11 +57,21 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Widgets/TreeView.hpp>
 #include <TGUI/Widgets/VerticalLayout.hpp>
+#include <mutex>
+#include <shared_mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Widgets may be loaded from multiple threads, while the construct functions are rarely changed
+        std::shared_timed_mutex constructFunctionsMutex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::map<std::string, std::function<Widget::Ptr()>> WidgetFactory::m_constructFunctions =
     {
         {"bitmapbutton", std::make_shared<BitmapButton>},
@@ -72,6 +83,7 @@ namespace tgui
         {"clickablewidget", std::make_shared<ClickableWidget>},
         {"combobox", std::make_shared<ComboBox>},
         {"editbox", std::make_shared<EditBox>},
+        {"flexlayout", std::make_shared<FlexLayout>},
         {"grid", std::make_shared<Grid>},
         {"group", std::make_shared<Group>},
         {"horizontallayout", std::make_shared<HorizontalLayout>},
@@ -102,14 +114,21 @@ namespace tgui
 
     void WidgetFactory::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
+        std::lock_guard<std::shared_timed_mutex> lock(constructFunctionsMutex);
         m_constructFunctions[toLower(type)] = constructor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::function<Widget::Ptr()>& WidgetFactory::getConstructFunction(const std::string& type)
+    std::function<Widget::Ptr()> WidgetFactory::getConstructFunction(const std::string& type)
     {
-        return m_constructFunctions[toLower(type)];
+        // The function is copied while the lock is held, so that setConstructFunction can't replace it while it is being used
+        std::shared_lock<std::shared_timed_mutex> lock(constructFunctionsMutex);
+        const auto it = m_constructFunctions.find(toLower(type));
+        if (it != m_constructFunctions.end())
+            return it->second;
+        else
+            return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,26 @@
 
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
+#include <mutex>
+#include <cstdint>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Widgets on different threads share the renderers of the default theme, so they may subscribe to the same renderer
+        // at the same time. The mutex that protects the observers is selected based on the address of the renderer data.
+        std::mutex& getObserverMutex(const RendererData* data)
+        {
+            static std::mutex observerMutexes[16];
+            return observerMutexes[(reinterpret_cast<std::uintptr_t>(data) >> 4) % 16];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +123,7 @@ namespace tgui
 
     void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
     {
+        std::lock_guard<std::mutex> lock(getObserverMutex(m_data.get()));
         m_data->observers[id] = function;
     }
 
@@ -115,6 +131,7 @@ namespace tgui
 
     void WidgetRenderer::unsubscribe(const void* id)
     {
+        std::lock_guard<std::mutex> lock(getObserverMutex(m_data.get()));
         m_data->observers.erase(id);
     }
 
@@ -28,18 +28,14 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <atomic>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
-    unsigned int lastId = 0;
-
-    unsigned int generateUniqueId()
-    {
-        return ++lastId;
-    }
+    std::atomic<unsigned int> lastId{0};
 
     template <typename T>
     bool checkParamType(std::initializer_list<std::type_index>::const_iterator type)
@@ -56,11 +52,6 @@ namespace
 
 namespace tgui
 {
-    namespace internal_signal
-    {
-        std::deque<const void*> parameters;
-    }
-
     namespace Signals
     {
         constexpr const char* const Widget::PositionChanged;
@@ -139,7 +130,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -150,7 +141,7 @@ namespace tgui
     unsigned int Signal::connect(const Delegate& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = handler;
+        addHandler(id, [handler](internal_signal::Parameters){ handler(); });
         return id;
     }
 
@@ -159,7 +150,16 @@ namespace tgui
     unsigned int Signal::connect(const DelegateEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name); });
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::connectWithParameters(const DelegateParameters& handler)
+    {
+        const auto id = generateUniqueId();
+        addHandler(id, handler);
         return id;
     }
 
@@ -167,21 +167,39 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        return m_handlers && m_handlers->remove(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (m_handlers)
+            m_handlers->clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Ptr Signal::getWidget()
+    void Signal::addHandler(unsigned int id, DelegateParameters function)
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        if (!m_handlers)
+            m_handlers = std::make_shared<internal_signal::HandlerList<DelegateParameters>>();
+
+        m_handlers->add(id, std::move(function));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::generateUniqueId()
+    {
+        return ++lastId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Signal::getWidget(const Widget* widget)
+    {
+        return const_cast<Widget*>(widget)->shared_from_this();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,30 +214,6 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
-    unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
-    { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
-    } \
-    \
-    unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
-    { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
-    }
-
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(UInt, unsigned int)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Bool, bool)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Float, float)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(String, const sf::String&)
-    TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Vector2f, Vector2f)
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     unsigned int SignalInt::validateTypes(std::initializer_list<std::type_index> unboundParameters) const
     {
         if ((unboundParameters.size() == 1) && checkParamType<int>(unboundParameters.begin()))
@@ -283,7 +277,7 @@ namespace tgui
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
         return id;
     }
 
@@ -292,7 +286,7 @@ namespace tgui
     unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
         return id;
     }
 
@@ -300,12 +294,8 @@ namespace tgui
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
-            return false;
-
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
-        return Signal::emit(widget);
+        const void* parameters[] = {&widget, &start, &end};
+        return emitWithParameters(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -323,7 +313,7 @@ namespace tgui
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
         return id;
     }
 
@@ -332,7 +322,7 @@ namespace tgui
     unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
         return id;
     }
 
@@ -340,12 +330,13 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
-        ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
-        internal_signal::parameters[1] = static_cast<const void*>(&sharedPtr);
-        return Signal::emit(childWindow);
+        const Widget* widget = childWindow;
+        const ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
+        const void* parameters[] = {&widget, &sharedPtr};
+        return emitWithParameters(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,7 +354,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -372,7 +363,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -381,7 +372,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
         return id;
     }
 
@@ -390,7 +381,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
         return id;
     }
 
@@ -399,7 +390,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemIndex& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<int>(internal_signal::parameters[3])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<int>(parameters[3])); });
         return id;
     }
 
@@ -408,7 +399,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemIndexEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<int>(internal_signal::parameters[3])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<int>(parameters[3])); });
         return id;
     }
 
@@ -434,7 +425,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -443,7 +434,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -452,7 +443,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFull& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
         return id;
     }
 
@@ -461,7 +452,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFullEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](internal_signal::Parameters parameters){ handler(getWidget(parameters), name, internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
         return id;
     }
 
@@ -26,6 +26,8 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/BackgroundConstruction.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -280,11 +282,18 @@ namespace tgui
             if (!m_svgTexture)
                 m_svgTexture = aurora::makeCopied<sf::Texture>();
 
-            const sf::Vector2u svgTextureSize{
-                static_cast<unsigned int>(std::round(getSize().x)),
-                static_cast<unsigned int>(std::round(getSize().y))};
+            // Rasterizing creates a texture, so when constructing in the background it is postponed until the sprite is drawn
+            if (BackgroundConstruction::getActive())
+                m_svgRasterizePending = true;
+            else
+            {
+                const sf::Vector2u svgTextureSize{
+                    static_cast<unsigned int>(std::round(getSize().x)),
+                    static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+                m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+                m_svgRasterizePending = false;
+            }
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
@@ -453,9 +462,23 @@ namespace tgui
 #endif
 
         if (m_texture.getData()->svgImage)
+        {
+            if (m_svgRasterizePending)
+            {
+                m_texture.getData()->svgImage->rasterize(*m_svgTexture, {static_cast<unsigned int>(std::round(getSize().x)),
+                                                                         static_cast<unsigned int>(std::round(getSize().y))});
+                m_svgRasterizePending = false;
+            }
+
             states.texture = m_svgTexture.get();
+        }
         else
+        {
+            // Textures loaded in the background are normally created by BackgroundConstruction::attach, unless the sprite
+            // was handed to the gui thread in another way
+            TextureManager::uploadPendingTexture(m_texture.getData());
             states.texture = &m_texture.getData()->texture;
+        }
 
         states.shader = m_shader;
         target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TaskQueue.hpp>
+#include <SFML/System/Clock.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    TaskQueue::TaskQueue() :
+        m_head{&m_stub},
+        m_tail{&m_stub}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueue::~TaskQueue()
+    {
+        while (Node* node = popNode())
+            delete node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TaskQueue::push(std::function<void()> task)
+    {
+        Node* node = new Node;
+        node->task = std::move(task);
+
+        ++m_taskCount;
+        pushNode(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TaskQueue::process(sf::Time budget)
+    {
+        // Tasks that get added while processing are not included in the count and thus not executed during this call
+        const std::size_t taskCount = m_taskCount.load();
+
+        sf::Clock clock;
+        std::size_t executedTasks = 0;
+        while (executedTasks < taskCount)
+        {
+            if ((executedTasks > 0) && (budget != sf::Time::Zero) && (clock.getElapsedTime() >= budget))
+                break;
+
+            Node* node = popNode();
+            if (!node)
+                break;
+
+            // The node is destroyed before executing the task, so that the queue remains valid when the task throws
+            const std::function<void()> task = std::move(node->task);
+            delete node;
+
+            --m_taskCount;
+            ++executedTasks;
+            task();
+        }
+
+        return executedTasks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TaskQueue::getTaskCount() const
+    {
+        return m_taskCount.load();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TaskQueue::pushNode(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+
+        // Between these two lines the list is temporarily broken: the previous node doesn't link to the new one yet.
+        // The thread executing the tasks will simply stop at the previous node until the link exists.
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TaskQueue::Node* TaskQueue::popNode()
+    {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        // The stub node doesn't contain a task and is skipped
+        if (tail == &m_stub)
+        {
+            if (!next)
+                return nullptr;
+
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        // A producer has already replaced the head but hasn't linked it to the last node yet
+        if (tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // The last node can only be removed when another node follows it, so the stub node is added behind it
+        pushNode(&m_stub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include <TGUI/Exception.hpp>
 #include <TGUI/TextureManager.hpp>
 
+#include <algorithm>
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +228,19 @@ namespace tgui
 
         if (m_data->svgImage)
             return m_data->svgImage->getSize();
+        else if (m_data->uploadPending)
+        {
+            // The texture doesn't exist yet, so calculate its size the same way as sf::Texture::loadFromImage will do
+            const sf::Vector2i imageSize{m_data->image->getSize()};
+            const sf::IntRect& rect = m_data->rect;
+            if ((rect.width == 0) || (rect.height == 0)
+             || ((rect.left <= 0) && (rect.top <= 0) && (rect.width >= imageSize.x) && (rect.height >= imageSize.y)))
+                return {sf::Vector2f{imageSize}};
+
+            const int left = std::max(rect.left, 0);
+            const int top = std::max(rect.top, 0);
+            return {static_cast<float>(std::min(rect.width, imageSize.x - left)), static_cast<float>(std::min(rect.height, imageSize.y - top))};
+        }
         else
             return {sf::Vector2f{m_data->texture.getSize()}};
     }
@@ -303,7 +317,7 @@ namespace tgui
         if (!m_data || !m_data->image)
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -387,7 +401,7 @@ namespace tgui
             if (m_data->svgImage)
                 m_middleRect = {0, 0, static_cast<int>(m_data->svgImage->getSize().x), static_cast<int>(m_data->svgImage->getSize().y)};
             else
-                m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+                m_middleRect = {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
         }
         else
             m_middleRect = middleRect;
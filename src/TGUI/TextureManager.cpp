@@ -26,108 +26,101 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/BackgroundConstruction.hpp>
+#include <SFML/System/Err.hpp>
+#include <cstdint>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<sf::String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    namespace
+    {
+        bool loadTextureFromImage(TextureData& data)
+        {
+            if (data.rect == sf::IntRect{})
+                return data.texture.loadFromImage(*data.image);
+            else
+                return data.texture.loadFromImage(*data.image, data.rect);
+        }
+
+        std::mutex uploadMutex; // Protects the creation of textures from images that were loaded in the background
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::array<TextureManager::ImageMapShard, TextureManager::ShardCount> TextureManager::m_imageMapShards;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect)
     {
-        // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
-        {
-            // Loop all our textures to find the one containing the image
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
-            {
-                // Only reuse the texture when the exact same part of the image is used
-                if (dataIt->data->rect == partRect)
-                {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
+        ImageMapShard& shard = getShard(filename);
 
-                    // Let the texture alert the texture manager when it is being copied or destroyed
-                    texture.setCopyCallback(&TextureManager::copyTexture);
-                    texture.setDestructCallback(&TextureManager::removeTexture);
-                    return dataIt->data;
-                }
-            }
-        }
-        else // The image doesn't exist yet
+        // Look if we already had this image
+        std::shared_ptr<TextureData> data;
         {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            data = findTexture(shard, filename, partRect);
         }
 
-        // Add new data to the list
-        TextureDataHolder dataHolder;
-        dataHolder.filename = filename;
-        dataHolder.users = 1;
-        dataHolder.data = std::make_shared<TextureData>();
-        dataHolder.data->rect = partRect;
-        imageIt->second.push_back(std::move(dataHolder));
+        if (!data)
+        {
+            // Load the image without holding the lock, so that other threads can keep using the textures of this shard
+            data = loadTexture(texture, filename, partRect);
+            if (!data)
+                return nullptr;
 
-        // Let the texture alert the texture manager when it is being copied or destroyed
-        texture.setCopyCallback(&TextureManager::copyTexture);
-        texture.setDestructCallback(&TextureManager::removeTexture);
+            std::lock_guard<std::mutex> lock(shard.mutex);
 
-        // Load the image
-        auto data = imageIt->second.back().data;
-        if ((filename.getSize() > 4) && (toLower(filename.substring(filename.getSize() - 4, 4)) == ".svg"))
-        {
-            data->svgImage = std::make_unique<SvgImage>(filename);
-            if (data->svgImage->isSet())
-                return data;
-        }
-        else // Not an svg
-        {
-            data->image = texture.getImageLoader()(filename);
-            if (data->image != nullptr)
+            // Another thread may have loaded the same image in the meantime, in which case our copy is thrown away
+            auto existingData = findTexture(shard, filename, partRect);
+            if (existingData)
+                data = existingData;
+            else
             {
-                // Create a texture from the image
-                bool loadFromImageSuccess;
-                if (partRect == sf::IntRect{})
-                    loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-                else
-                {
-                    if ((partRect.left < static_cast<int>(data->image->getSize().x)) && (partRect.top < static_cast<int>(data->image->getSize().y)))
-                        loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
-                    else
-                        loadFromImageSuccess = false;
-                }
+                TextureDataHolder dataHolder;
+                dataHolder.filename = filename;
+                dataHolder.users = 1;
+                dataHolder.data = data;
+                shard.images[filename].push_back(std::move(dataHolder));
 
-                if (loadFromImageSuccess)
-                    return data;
+                // When constructing widgets in the background, the texture is only created when the widgets are attached
+                if (data->uploadPending)
+                    BackgroundConstruction::getActive()->addPendingTexture(data);
             }
         }
 
-        // The image could not be loaded
-        if (imageIt->second.size() > 1)
-            imageIt->second.pop_back();
-        else
-            m_imageMap.erase(imageIt);
+        // The image may have been loaded in the background, the gui thread can't wait until it gets attached
+        if (data->uploadPending && !BackgroundConstruction::getActive())
+            uploadPendingTexture(data);
 
-        return nullptr;
+        // Let the texture alert the texture manager when it is being copied or destroyed
+        texture.setCopyCallback(&TextureManager::copyTexture);
+        texture.setDestructCallback(&TextureManager::removeTexture);
+        return data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        if (!textureDataToCopy)
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        ImageMapShard& shard = getShard(textureDataToCopy->filename);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto imageIt = shard.images.find(textureDataToCopy->filename);
+        if (imageIt != shard.images.end())
         {
-            for (auto& data : dataHolder.second)
+            for (auto& dataHolder : imageIt->second)
             {
                 // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
+                if (dataHolder.data == textureDataToCopy)
                 {
                     // The texture is now used at multiple places
-                    ++data.users;
+                    ++dataHolder.users;
                     return;
                 }
             }
@@ -140,8 +133,14 @@ namespace tgui
 
     void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        if (!textureDataToRemove)
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        ImageMapShard& shard = getShard(textureDataToRemove->filename);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto imageIt = shard.images.find(textureDataToRemove->filename);
+        if (imageIt != shard.images.end())
         {
             for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
             {
@@ -153,7 +152,7 @@ namespace tgui
                     {
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
+                            shard.images.erase(imageIt);
                     }
 
                     return;
@@ -165,6 +164,96 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::uploadPendingTexture(const std::shared_ptr<TextureData>& data)
+    {
+        if (!data->uploadPending)
+            return;
+
+        std::lock_guard<std::mutex> lock(uploadMutex);
+        if (data->uploadPending)
+        {
+            if (!loadTextureFromImage(*data))
+                TGUI_PRINT_WARNING("failed to create texture from image that was loaded in the background.");
+
+            data->uploadPending = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::ImageMapShard& TextureManager::getShard(const sf::String& filename)
+    {
+        // FNV-1a hash of the characters, the filenames of images in the same folder only differ near the end
+        std::uint32_t hash = 2166136261u;
+        for (const sf::Uint32 c : filename)
+            hash = (hash ^ c) * 16777619u;
+
+        return m_imageMapShards[hash % ShardCount];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::findTexture(ImageMapShard& shard, const sf::String& filename, const sf::IntRect& partRect)
+    {
+        auto imageIt = shard.images.find(filename);
+        if (imageIt == shard.images.end())
+            return nullptr;
+
+        // Loop all our textures to find the one containing the image
+        for (auto& dataHolder : imageIt->second)
+        {
+            // Only reuse the texture when the exact same part of the image is used
+            if (dataHolder.data->rect == partRect)
+            {
+                // The texture is now used at multiple places
+                ++dataHolder.users;
+                return dataHolder.data;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::loadTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect)
+    {
+        auto data = std::make_shared<TextureData>();
+        data->filename = filename;
+        data->rect = partRect;
+
+        if ((filename.getSize() > 4) && (toLower(filename.substring(filename.getSize() - 4, 4)) == ".svg"))
+        {
+            data->svgImage = std::make_unique<SvgImage>(filename);
+            if (data->svgImage->isSet())
+                return data;
+        }
+        else // Not an svg
+        {
+            data->image = texture.getImageLoader()(filename);
+            if ((data->image != nullptr)
+             && ((partRect == sf::IntRect{})
+              || ((partRect.left < static_cast<int>(data->image->getSize().x)) && (partRect.top < static_cast<int>(data->image->getSize().y)))))
+            {
+                // The texture is created later when constructing widgets in the background
+                if (BackgroundConstruction::getActive())
+                {
+                    data->uploadPending = true;
+                    return data;
+                }
+
+                // Create a texture from the image
+                if (loadTextureFromImage(*data))
+                    return data;
+            }
+        }
+
+        // The image could not be loaded
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,10 +127,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,10 +413,16 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
-            onPositionChange.emit(this, getPosition());
+            if (!queueGeometrySignal(m_positionChangePending))
+                onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
+
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            invalidateHoverCaches();
         }
     }
 
@@ -431,15 +437,37 @@ namespace tgui
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
-            onSizeChange.emit(this, getSize());
+            if (!queueGeometrySignal(m_sizeChangePending))
+                onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
+
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            invalidateHoverCaches();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::queueGeometrySignal(bool& pendingFlag)
+    {
+        // Widgets that aren't part of a gui (e.g. the ones created by a BackgroundConstruction) always emit their signals directly.
+        // Both checks are plain member loads, so the common case where coalescing is disabled stays cheap.
+        if (!m_guiContainer || !m_guiContainer->isCoalescedGeometrySignals())
+            return false;
+
+        pendingFlag = true;
+        if (!m_geometrySignalsQueued)
+            m_guiContainer->queueGeometrySignals(*this);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Widget::getFullSize() const
     {
         return getSize();
@@ -550,6 +578,8 @@ namespace tgui
                 break;
             }
         }
+
+        scheduleUpdate({});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -617,7 +647,7 @@ namespace tgui
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
                 else
-                {
+                {
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToBottom) does not work before widget has a parent.");
                 }
 
@@ -630,17 +660,25 @@ namespace tgui
                 break;
             }
         }
+
+        scheduleUpdate({});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setVisible(bool visible)
     {
+        const bool wasVisible = m_visible;
         m_visible = visible;
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
             setFocused(false);
+        else if (!wasVisible && m_guiContainer)
+        {
+            // Hidden widgets lose their scheduled updates, so the widget and its children get a new one when they are shown
+            m_guiContainer->scheduleVisibleWidgets(*this);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -786,8 +824,23 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
+        GuiContainer* const oldGuiContainer = m_guiContainer;
+        GuiContainer* const newGuiContainer = parent ? parent->m_guiContainer : nullptr;
         m_parent = parent;
 
+        if (oldGuiContainer != newGuiContainer)
+        {
+            // The children have to know the new gui before the old one recalculates their layouts
+            setGuiContainer(newGuiContainer);
+
+            if (oldGuiContainer)
+                oldGuiContainer->widgetDetached(*this);
+
+            // Widgets can't schedule updates while they aren't part of a gui, so they get one when they are added
+            if (newGuiContainer)
+                newGuiContainer->scheduleVisibleWidgets(*this);
+        }
+
         // Give the layouts another chance to find widgets to which it refers
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -808,6 +861,19 @@ namespace tgui
             else
                 i++;
         }
+
+        // Animations need to be updated every frame until they are finished
+        if (!m_showAnimations.empty())
+            scheduleUpdate({});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleUpdate(sf::Time delay)
+    {
+        GuiContainer* guiContainer = getGuiContainer();
+        if (guiContainer)
+            guiContainer->scheduleUpdate(*this, delay);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -951,22 +1017,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::recalculateLayouts()
+    {
+        m_position.x.calculateValue();
+        m_position.y.calculateValue();
+        m_size.x.calculateValue();
+        m_size.y.calculateValue();
+
+        if (getSize() != m_prevSize)
+            setSize(getSizeLayout());
+
+        if (getPosition() != m_prevPosition)
+            setPosition(getPositionLayout());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& Widget::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onPositionChange.getName()))
-            return onPositionChange;
-        else if (signalName == toLower(onSizeChange.getName()))
-            return onSizeChange;
-        else if (signalName == toLower(onFocus.getName()))
-            return onFocus;
-        else if (signalName == toLower(onUnfocus.getName()))
-            return onUnfocus;
-        else if (signalName == toLower(onMouseEnter.getName()))
-            return onMouseEnter;
-        else if (signalName == toLower(onMouseLeave.getName()))
-            return onMouseLeave;
-        else if (signalName == toLower(onAnimationFinished.getName()))
-            return onAnimationFinished;
+        static const internal_signal::SignalTable<Widget> signals{*this, {
+                [](Widget& widget) -> Signal& { return widget.onPositionChange; },
+                [](Widget& widget) -> Signal& { return widget.onSizeChange; },
+                [](Widget& widget) -> Signal& { return widget.onFocus; },
+                [](Widget& widget) -> Signal& { return widget.onUnfocus; },
+                [](Widget& widget) -> Signal& { return widget.onMouseEnter; },
+                [](Widget& widget) -> Signal& { return widget.onMouseLeave; },
+                [](Widget& widget) -> Signal& { return widget.onAnimationFinished; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
 
         throw Exception{"No signal exists with name '" + std::move(signalName) + "'."};
     }
@@ -980,7 +1060,7 @@ namespace tgui
             if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
                 m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
             else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
         else if (property == "font")
         {
@@ -1093,7 +1173,7 @@ namespace tgui
                         throw Exception{"ToolTip section contained multiple children."};
 
                     const auto& toolTipWidgetNode = childNode->children[0];
-                    const auto& constructor = WidgetFactory::getConstructFunction(toolTipWidgetNode->name);
+                    const auto constructor = WidgetFactory::getConstructFunction(toolTipWidgetNode->name);
                     if (constructor)
                     {
                         Widget::Ptr toolTip = constructor();
@@ -1132,9 +1212,42 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setGuiContainer(GuiContainer* guiContainer)
+    {
+        m_guiContainer = guiContainer;
+
+        if (isContainer())
+        {
+            for (const auto& child : static_cast<Container*>(this)->getWidgets())
+                child->setGuiContainer(guiContainer);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+
+        // Properties such as the borders can change the full size of the widget without a call to setSize
+        invalidateHoverCaches();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateHoverCaches()
+    {
+        // Nothing is cached while the cache is disabled, enabling it again discards all caches that were made before
+        if (!Container::isHoverCacheEnabled())
+            return;
+
+        // A container caches which of its children is below the mouse, which can change when any of its descendants changes
+        Container* container = m_containerWidget ? static_cast<Container*>(this) : m_parent;
+        while (container)
+        {
+            ++container->m_hoverGeneration;
+            container = container->getParent();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,32 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Ends the batch of changes that load started when loading fails. Arranging the partially loaded widgets may throw
+        // as well, but that exception can't replace the one that is already being thrown.
+        struct EndUpdateOnFailure
+        {
+            BoxLayout* layout;
+
+            ~EndUpdateOnFailure()
+            {
+                if (!layout)
+                    return;
+
+                try
+                {
+                    layout->endUpdate();
+                }
+                catch (...)
+                {
+                }
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BoxLayout::BoxLayout(const Layout2d& size) :
         Group{size}
     {
@@ -71,7 +97,7 @@ namespace tgui
     {
         Container::setSize(size);
 
-        updateWidgets();
+        requestWidgetsUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,7 +125,19 @@ namespace tgui
         else // Just add the widget to the back
             Group::add(widget, widgetName);
 
-        updateWidgets();
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::addMultiple(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        beginUpdate();
+
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            add(widgets[i], (i < widgetNames.size()) ? widgetNames[i] : "");
+
+        endUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,7 +162,7 @@ namespace tgui
 
         Group::remove(m_widgets[index]);
 
-        updateWidgets();
+        requestWidgetsUpdate();
         return true;
     }
 
@@ -140,12 +178,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BoxLayout::beginUpdate()
+    {
+        ++m_updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::endUpdate()
+    {
+        if (m_updateDepth == 0)
+        {
+            TGUI_PRINT_WARNING("endUpdate called without matching beginUpdate.");
+            return;
+        }
+
+        --m_updateDepth;
+        if ((m_updateDepth == 0) && m_pendingWidgetsUpdate)
+        {
+            m_pendingWidgetsUpdate = false;
+            updateWidgets();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BoxLayout::isUpdating() const
+    {
+        return m_updateDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BoxLayout::rendererChanged(const std::string& property)
     {
         if (property == "spacebetweenwidgets")
         {
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            requestWidgetsUpdate();
         }
         else if (property == "padding")
         {
@@ -153,13 +223,37 @@ namespace tgui
 
             // Update the space between widgets as the padding is used when no space was explicitly set
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            requestWidgetsUpdate();
         }
         else
             Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        // Only position the child widgets once, after all of them were loaded
+        beginUpdate();
+        EndUpdateOnFailure endUpdateOnFailure{this};
+
+        Group::load(node, renderers);
+
+        endUpdateOnFailure.layout = nullptr;
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::requestWidgetsUpdate()
+    {
+        if (m_updateDepth > 0)
+            m_pendingWidgetsUpdate = true;
+        else
+            updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,32 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Ends the batch of changes that load started when loading fails. Arranging the partially loaded widgets may throw
+        // as well, but that exception can't replace the one that is already being thrown.
+        struct EndUpdateOnFailure
+        {
+            BoxLayout* layout;
+
+            ~EndUpdateOnFailure()
+            {
+                if (!layout)
+                    return;
+
+                try
+                {
+                    layout->endUpdate();
+                }
+                catch (...)
+                {
+                }
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BoxLayoutRatios::BoxLayoutRatios(const Layout2d& size) :
         BoxLayout{size}
     {
@@ -122,7 +148,7 @@ namespace tgui
             return false;
 
         m_ratios[index] = ratio;
-        updateWidgets();
+        requestWidgetsUpdate();
         return true;
     }
 
@@ -172,6 +198,10 @@ namespace tgui
 
     void BoxLayoutRatios::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
     {
+        // Don't reposition the child widgets for every ratio that is set
+        beginUpdate();
+        EndUpdateOnFailure endUpdateOnFailure{this};
+
         BoxLayout::load(node, renderers);
 
         if (node->propertyValuePairs["ratios"])
@@ -185,6 +215,9 @@ namespace tgui
             for (std::size_t i = 0; i < node->propertyValuePairs["ratios"]->valueList.size(); ++i)
                 setRatio(i, Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs["ratios"]->valueList[i]).getNumber());
         }
+
+        endUpdateOnFailure.layout = nullptr;
+        endUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
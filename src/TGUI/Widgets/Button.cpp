@@ -251,8 +251,12 @@ namespace tgui
 
     Signal& Button::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onPress.getName()))
-            return onPress;
+        static const internal_signal::SignalTable<Button> signals{*this, {
+                [](Button& button) -> Signal& { return button.onPress; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
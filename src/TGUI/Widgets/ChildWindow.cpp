@@ -761,16 +761,16 @@ namespace tgui
 
     Signal& ChildWindow::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onClose.getName()))
-            return onClose;
-        else if (signalName == toLower(onMinimize.getName()))
-            return onMinimize;
-        else if (signalName == toLower(onMaximize.getName()))
-            return onMaximize;
-        else if (signalName == toLower(onEscapeKeyPressed.getName()))
-            return onEscapeKeyPressed;
+        static const internal_signal::SignalTable<ChildWindow> signals{*this, {
+                [](ChildWindow& childWindow) -> Signal& { return childWindow.onMousePress; },
+                [](ChildWindow& childWindow) -> Signal& { return childWindow.onClose; },
+                [](ChildWindow& childWindow) -> Signal& { return childWindow.onMinimize; },
+                [](ChildWindow& childWindow) -> Signal& { return childWindow.onMaximize; },
+                [](ChildWindow& childWindow) -> Signal& { return childWindow.onEscapeKeyPressed; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Container::getSignal(std::move(signalName));
     }
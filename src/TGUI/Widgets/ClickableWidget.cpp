@@ -119,18 +119,17 @@ namespace tgui
 
     Signal& ClickableWidget::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
-        else if (signalName == toLower(onRightMousePress.getName()))
-            return onRightMousePress;
-        else if (signalName == toLower(onRightMouseRelease.getName()))
-            return onRightMouseRelease;
-        else if (signalName == toLower(onRightClick.getName()))
-            return onRightClick;
+        static const internal_signal::SignalTable<ClickableWidget> signals{*this, {
+                [](ClickableWidget& clickableWidget) -> Signal& { return clickableWidget.onMousePress; },
+                [](ClickableWidget& clickableWidget) -> Signal& { return clickableWidget.onMouseRelease; },
+                [](ClickableWidget& clickableWidget) -> Signal& { return clickableWidget.onClick; },
+                [](ClickableWidget& clickableWidget) -> Signal& { return clickableWidget.onRightMousePress; },
+                [](ClickableWidget& clickableWidget) -> Signal& { return clickableWidget.onRightMouseRelease; },
+                [](ClickableWidget& clickableWidget) -> Signal& { return clickableWidget.onRightClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -347,14 +347,15 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const bool ret = m_listBox->removeItemById(id);
 
-        return false;
+        m_text.setString(m_listBox->getSelectedItem());
+
+        // Shrink the list size
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+            updateListBoxHeight();
+
+        return ret;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -513,16 +514,49 @@ namespace tgui
 
     bool ComboBox::contains(const sf::String& item) const
     {
-        const auto& items = getItems();
-        return std::find(items.begin(), items.end(), item) != items.end();
+        return m_listBox->contains(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::containsId(const sf::String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setSearchIndexEnabled(bool enabled)
+    {
+        m_listBox->setSearchIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isSearchIndexEnabled() const
+    {
+        return m_listBox->isSearchIndexEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ComboBox::findItemsWithPrefix(const sf::String& prefix, std::size_t maxResults) const
+    {
+        return m_listBox->findItemsWithPrefix(prefix, maxResults);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setTypeAheadEnabled(bool enabled)
+    {
+        m_listBox->setTypeAheadEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isTypeAheadEnabled() const
+    {
+        return m_listBox->isTypeAheadEnabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -619,16 +653,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::textEntered(std::uint32_t key)
+    {
+        // Typing while the list is open is handled by the list box itself, which has the focus at that moment
+        if (m_listBox->isVisible())
+            return;
+
+        // Let the list box find and select the item that starts with the typed text
+        const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
+        m_listBox->textEntered(key);
+
+        const sf::Time typeAheadTime = m_listBox->getRemainingTypeAheadTime();
+        if (typeAheadTime > sf::Time::Zero)
+            scheduleUpdate(typeAheadTime);
+
+        if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
+        {
+            m_text.setString(m_listBox->getSelectedItem());
+            onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId(), m_listBox->getSelectedItemIndex());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& ComboBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
+        static const internal_signal::SignalTable<ComboBox> signals{*this, {
+                [](ComboBox& comboBox) -> Signal& { return comboBox.onItemSelect; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        if (!m_listBox->getParent())
+        {
+            static_cast<Widget&>(*m_listBox).update(elapsedTime);
+
+            const sf::Time typeAheadTime = m_listBox->getRemainingTypeAheadTime();
+            if (typeAheadTime > sf::Time::Zero)
+                scheduleUpdate(typeAheadTime);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::rendererChanged(const std::string& property)
     {
         if (property == "borders")
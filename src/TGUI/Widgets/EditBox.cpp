@@ -478,6 +478,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            scheduleUpdate(sf::milliseconds(500));
         }
         else // Unfocusing
         {
@@ -556,6 +557,7 @@ namespace tgui
         // The caret should be visible
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        scheduleUpdate(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -894,6 +896,7 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        scheduleUpdate(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -962,6 +965,7 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        scheduleUpdate(sf::milliseconds(500));
 
         onTextChange.emit(this, m_text);
     }
@@ -970,10 +974,13 @@ namespace tgui
 
     Signal& EditBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
-        else if (signalName == toLower(onReturnKeyPress.getName()))
-            return onReturnKeyPress;
+        static const internal_signal::SignalTable<EditBox> signals{*this, {
+                [](EditBox& editBox) -> Signal& { return editBox.onTextChange; },
+                [](EditBox& editBox) -> Signal& { return editBox.onReturnKeyPress; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
@@ -1504,6 +1511,10 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        // Keep blinking the caret while focused
+        if (m_focused || m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
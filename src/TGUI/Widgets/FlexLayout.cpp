@@ -0,0 +1,728 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/FlexLayout.hpp>
+
+#include <functional>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        float clampSize(float size, float minimum, float maximum)
+        {
+            if ((maximum > 0) && (size > maximum))
+                size = maximum;
+            if (size < minimum)
+                size = minimum;
+            return size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Ends the batch of changes that load started when loading fails. Arranging the partially loaded widgets may throw
+        // as well, but that exception can't replace the one that is already being thrown.
+        struct EndUpdateOnFailure
+        {
+            BoxLayout* layout;
+
+            ~EndUpdateOnFailure()
+            {
+                if (!layout)
+                    return;
+
+                try
+                {
+                    layout->endUpdate();
+                }
+                catch (...)
+                {
+                }
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::FlexLayout(const Layout2d& size) :
+        BoxLayout{size}
+    {
+        m_type = "FlexLayout";
+
+        m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
+        setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Ptr FlexLayout::create(const Layout2d& size)
+    {
+        return std::make_shared<FlexLayout>(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Ptr FlexLayout::copy(FlexLayout::ConstPtr layout)
+    {
+        if (layout)
+            return std::static_pointer_cast<FlexLayout>(layout->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        if (index > m_items.size())
+            index = m_items.size();
+
+        // The widgets may only be placed after the item exists, but its size has to be read after the widget has a parent
+        beginUpdate();
+        m_items.insert(m_items.begin() + index, Item{});
+        BoxLayout::insert(index, widget, widgetName);
+        m_items[index].naturalSize = widget->getSize();
+        m_items[index].arrangedSize = m_items[index].naturalSize;
+        invalidateMeasurements();
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::remove(std::size_t index)
+    {
+        if (index < m_items.size())
+        {
+            m_items.erase(m_items.begin() + index);
+            m_measurementsValid = false;
+        }
+
+        return BoxLayout::remove(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::removeAllWidgets()
+    {
+        BoxLayout::removeAllWidgets();
+        m_items.clear();
+        m_measurementsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::childWidgetBoundsChanged(const Widget* child)
+    {
+        BoxLayout::childWidgetBoundsChanged(child);
+
+        // Only a size that wasn't given by the layout itself replaces the natural size of the widget
+        if (m_arrangingWidgets)
+            return;
+
+        for (std::size_t i = 0; i < std::min(m_widgets.size(), m_items.size()); ++i)
+        {
+            if (m_widgets[i].get() == child)
+            {
+                if (child->getSize() != m_items[i].arrangedSize)
+                {
+                    m_items[i].naturalSize = child->getSize();
+                    m_items[i].arrangedSize = m_items[i].naturalSize;
+                    invalidateMeasurements();
+                }
+
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setDirection(Direction direction)
+    {
+        m_direction = direction;
+        invalidateMeasurements();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Direction FlexLayout::getDirection() const
+    {
+        return m_direction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setWrap(bool wrap)
+    {
+        m_wrap = wrap;
+        invalidateMeasurements();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::getWrap() const
+    {
+        return m_wrap;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setJustification(Justification justification)
+    {
+        m_justification = justification;
+        invalidateMeasurements();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Justification FlexLayout::getJustification() const
+    {
+        return m_justification;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setAlignment(Alignment alignment)
+    {
+        m_alignment = alignment;
+        invalidateMeasurements();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Alignment FlexLayout::getAlignment() const
+    {
+        return m_alignment;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemGrow(const Widget::Ptr& widget, float grow)
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].grow = std::max(0.f, grow);
+        invalidateMeasurements();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getItemGrow(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return 0;
+
+        return m_items[index].grow;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemShrink(const Widget::Ptr& widget, float shrink)
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].shrink = std::max(0.f, shrink);
+        invalidateMeasurements();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getItemShrink(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return 0;
+
+        return m_items[index].shrink;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemBasis(const Widget::Ptr& widget, float basis)
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].basis = basis;
+        invalidateMeasurements();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getItemBasis(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return -1;
+
+        return m_items[index].basis;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemMinimumSize(const Widget::Ptr& widget, Vector2f minimumSize)
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].minimumSize = minimumSize;
+        invalidateMeasurements();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f FlexLayout::getItemMinimumSize(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return {0, 0};
+
+        return m_items[index].minimumSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemMaximumSize(const Widget::Ptr& widget, Vector2f maximumSize)
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].maximumSize = maximumSize;
+        invalidateMeasurements();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f FlexLayout::getItemMaximumSize(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = getItemIndex(widget);
+        if (index >= m_items.size())
+            return {0, 0};
+
+        return m_items[index].maximumSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> FlexLayout::save(SavingRenderersMap& renderers) const
+    {
+        auto node = BoxLayout::save(renderers);
+
+        if (m_direction == Direction::Column)
+            node->propertyValuePairs["Direction"] = std::make_unique<DataIO::ValueNode>("Column");
+
+        if (m_wrap)
+            node->propertyValuePairs["Wrap"] = std::make_unique<DataIO::ValueNode>("true");
+
+        if (m_justification != Justification::Start)
+        {
+            if (m_justification == Justification::Center)
+                node->propertyValuePairs["Justification"] = std::make_unique<DataIO::ValueNode>("Center");
+            else if (m_justification == Justification::End)
+                node->propertyValuePairs["Justification"] = std::make_unique<DataIO::ValueNode>("End");
+            else if (m_justification == Justification::SpaceBetween)
+                node->propertyValuePairs["Justification"] = std::make_unique<DataIO::ValueNode>("SpaceBetween");
+            else if (m_justification == Justification::SpaceAround)
+                node->propertyValuePairs["Justification"] = std::make_unique<DataIO::ValueNode>("SpaceAround");
+        }
+
+        if (m_alignment != Alignment::Stretch)
+        {
+            if (m_alignment == Alignment::Start)
+                node->propertyValuePairs["Alignment"] = std::make_unique<DataIO::ValueNode>("Start");
+            else if (m_alignment == Alignment::Center)
+                node->propertyValuePairs["Alignment"] = std::make_unique<DataIO::ValueNode>("Center");
+            else if (m_alignment == Alignment::End)
+                node->propertyValuePairs["Alignment"] = std::make_unique<DataIO::ValueNode>("End");
+        }
+
+        if (!m_items.empty())
+        {
+            const auto serializeSize = [](Vector2f size){ return Serializer::serialize(sf::String{"(" + to_string(size.x) + ", " + to_string(size.y) + ")"}); };
+
+            // When the widget uses its own size as basis, the size from when it was added is stored as its basis. The size that
+            // is saved for the widget itself is the one that was given to it by this layout.
+            const auto getBasis = [this](const Item& item){ return (item.basis >= 0) ? item.basis : ((m_direction == Direction::Row) ? item.naturalSize.x : item.naturalSize.y); };
+
+            std::string growList = "[" + Serializer::serialize(m_items[0].grow);
+            std::string shrinkList = "[" + Serializer::serialize(m_items[0].shrink);
+            std::string basisList = "[" + Serializer::serialize(getBasis(m_items[0]));
+            std::string minimumSizeList = "[" + serializeSize(m_items[0].minimumSize);
+            std::string maximumSizeList = "[" + serializeSize(m_items[0].maximumSize);
+            for (std::size_t i = 1; i < m_items.size(); ++i)
+            {
+                growList += ", " + Serializer::serialize(m_items[i].grow);
+                shrinkList += ", " + Serializer::serialize(m_items[i].shrink);
+                basisList += ", " + Serializer::serialize(getBasis(m_items[i]));
+                minimumSizeList += ", " + serializeSize(m_items[i].minimumSize);
+                maximumSizeList += ", " + serializeSize(m_items[i].maximumSize);
+            }
+
+            node->propertyValuePairs["Grow"] = std::make_unique<DataIO::ValueNode>(growList + "]");
+            node->propertyValuePairs["Shrink"] = std::make_unique<DataIO::ValueNode>(shrinkList + "]");
+            node->propertyValuePairs["Basis"] = std::make_unique<DataIO::ValueNode>(basisList + "]");
+            node->propertyValuePairs["MinimumSizes"] = std::make_unique<DataIO::ValueNode>(minimumSizeList + "]");
+            node->propertyValuePairs["MaximumSizes"] = std::make_unique<DataIO::ValueNode>(maximumSizeList + "]");
+        }
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        beginUpdate();
+        EndUpdateOnFailure endUpdateOnFailure{this};
+
+        BoxLayout::load(node, renderers);
+
+        if (node->propertyValuePairs["direction"])
+        {
+            const std::string direction = toLower(trim(node->propertyValuePairs["direction"]->value));
+            if (direction == "row")
+                setDirection(Direction::Row);
+            else if (direction == "column")
+                setDirection(Direction::Column);
+            else
+                throw Exception{"Failed to parse Direction property, found unknown value."};
+        }
+
+        if (node->propertyValuePairs["wrap"])
+            setWrap(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["wrap"]->value).getBool());
+
+        if (node->propertyValuePairs["justification"])
+        {
+            const std::string justification = toLower(trim(node->propertyValuePairs["justification"]->value));
+            if (justification == "start")
+                setJustification(Justification::Start);
+            else if (justification == "center")
+                setJustification(Justification::Center);
+            else if (justification == "end")
+                setJustification(Justification::End);
+            else if (justification == "spacebetween")
+                setJustification(Justification::SpaceBetween);
+            else if (justification == "spacearound")
+                setJustification(Justification::SpaceAround);
+            else
+                throw Exception{"Failed to parse Justification property, found unknown value."};
+        }
+
+        if (node->propertyValuePairs["alignment"])
+        {
+            const std::string alignment = toLower(trim(node->propertyValuePairs["alignment"]->value));
+            if (alignment == "start")
+                setAlignment(Alignment::Start);
+            else if (alignment == "center")
+                setAlignment(Alignment::Center);
+            else if (alignment == "end")
+                setAlignment(Alignment::End);
+            else if (alignment == "stretch")
+                setAlignment(Alignment::Stretch);
+            else
+                throw Exception{"Failed to parse Alignment property, found unknown value."};
+        }
+
+        const auto loadList = [&](const std::string& property, const std::string& name, const std::function<void(Item&, const std::string&)>& setter)
+            {
+                if (!node->propertyValuePairs[property])
+                    return;
+
+                if (!node->propertyValuePairs[property]->listNode)
+                    throw Exception{"Failed to parse '" + name + "' property, expected a list as value"};
+
+                if (node->propertyValuePairs[property]->valueList.size() != m_items.size())
+                    throw Exception{"Amounts of values for '" + name + "' differs from the amount in child widgets"};
+
+                for (std::size_t i = 0; i < m_items.size(); ++i)
+                    setter(m_items[i], node->propertyValuePairs[property]->valueList[i]);
+            };
+
+        const auto parseNumber = [](const std::string& value){ return Deserializer::deserialize(ObjectConverter::Type::Number, value).getNumber(); };
+        const auto parseSize = [](const std::string& value){ return Vector2f{Deserializer::deserialize(ObjectConverter::Type::String, value).getString().toAnsiString()}; };
+
+        loadList("grow", "Grow", [&](Item& item, const std::string& value){ item.grow = parseNumber(value); });
+        loadList("shrink", "Shrink", [&](Item& item, const std::string& value){ item.shrink = parseNumber(value); });
+        loadList("basis", "Basis", [&](Item& item, const std::string& value){ item.basis = parseNumber(value); });
+        loadList("minimumsizes", "MinimumSizes", [&](Item& item, const std::string& value){ item.minimumSize = parseSize(value); });
+        loadList("maximumsizes", "MaximumSizes", [&](Item& item, const std::string& value){ item.maximumSize = parseSize(value); });
+
+        invalidateMeasurements();
+
+        endUpdateOnFailure.layout = nullptr;
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::updateWidgets()
+    {
+        const Vector2f contentSize = {std::max(0.f, getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight()),
+                                      std::max(0.f, getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom())};
+
+        // Nothing has to be done when neither the widgets nor the available space changed
+        if (m_measurementsValid && (contentSize == m_arrangedContentSize) && (m_spaceBetweenWidgetsCached == m_arrangedSpaceBetweenWidgets))
+            return;
+
+        measureItems();
+        m_arrangedContentSize = contentSize;
+        m_arrangedSpaceBetweenWidgets = m_spaceBetweenWidgetsCached;
+
+        m_arrangingWidgets = true;
+
+        const bool row = (m_direction == Direction::Row);
+        const float availableMainSize = row ? contentSize.x : contentSize.y;
+        const float availableCrossSize = row ? contentSize.y : contentSize.x;
+        const float space = m_spaceBetweenWidgetsCached;
+
+        float crossOffset = 0;
+        std::size_t lineStart = 0;
+        while (lineStart < m_items.size())
+        {
+            // Find out which widgets fit on this line
+            std::size_t lineEnd = m_items.size();
+            if (m_wrap)
+            {
+                float lineMainSize = m_measurements[lineStart].hypotheticalMainSize;
+                lineEnd = lineStart + 1;
+                while ((lineEnd < m_items.size()) && (lineMainSize + space + m_measurements[lineEnd].hypotheticalMainSize <= availableMainSize))
+                {
+                    lineMainSize += space + m_measurements[lineEnd].hypotheticalMainSize;
+                    ++lineEnd;
+                }
+            }
+
+            resolveFlexibleLengths(lineStart, lineEnd, availableMainSize);
+
+            // A single line fills the entire layout, otherwise each line is as high as its highest widget
+            float lineCrossSize = 0;
+            float usedMainSize = space * (lineEnd - lineStart - 1);
+            for (std::size_t i = lineStart; i < lineEnd; ++i)
+            {
+                lineCrossSize = std::max(lineCrossSize, m_measurements[i].crossSize);
+                usedMainSize += m_measurements[i].mainSize;
+            }
+            if (!m_wrap)
+                lineCrossSize = availableCrossSize;
+
+            const float freeSpace = std::max(0.f, availableMainSize - usedMainSize);
+            const std::size_t widgetsInLine = lineEnd - lineStart;
+            float mainOffset = 0;
+            float extraSpace = 0;
+            if (m_justification == Justification::Center)
+                mainOffset = freeSpace / 2.f;
+            else if (m_justification == Justification::End)
+                mainOffset = freeSpace;
+            else if ((m_justification == Justification::SpaceBetween) && (widgetsInLine > 1))
+                extraSpace = freeSpace / (widgetsInLine - 1);
+            else if (m_justification == Justification::SpaceAround)
+            {
+                extraSpace = freeSpace / widgetsInLine;
+                mainOffset = extraSpace / 2.f;
+            }
+
+            for (std::size_t i = lineStart; i < lineEnd; ++i)
+            {
+                const Item& item = m_items[i];
+                const Measurement& measurement = m_measurements[i];
+
+                float crossSize = measurement.crossSize;
+                float crossPosition = 0;
+                if (m_alignment == Alignment::Stretch)
+                    crossSize = clampSize(lineCrossSize, row ? item.minimumSize.y : item.minimumSize.x, row ? item.maximumSize.y : item.maximumSize.x);
+                else if (m_alignment == Alignment::Center)
+                    crossPosition = (lineCrossSize - crossSize) / 2.f;
+                else if (m_alignment == Alignment::End)
+                    crossPosition = lineCrossSize - crossSize;
+
+                if (row)
+                {
+                    m_widgets[i]->setPosition({mainOffset, crossOffset + crossPosition});
+                    m_widgets[i]->setSize({measurement.mainSize, crossSize});
+                }
+                else
+                {
+                    m_widgets[i]->setPosition({crossOffset + crossPosition, mainOffset});
+                    m_widgets[i]->setSize({crossSize, measurement.mainSize});
+                }
+
+                m_items[i].arrangedSize = m_widgets[i]->getSize();
+                mainOffset += measurement.mainSize + space + extraSpace;
+            }
+
+            crossOffset += lineCrossSize + space;
+            lineStart = lineEnd;
+        }
+
+        m_arrangingWidgets = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t FlexLayout::getItemIndex(const Widget::Ptr& widget) const
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+                return i;
+        }
+
+        return m_widgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::measureItems()
+    {
+        if (m_measurementsValid)
+            return;
+
+        const bool row = (m_direction == Direction::Row);
+        m_measurements.resize(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            const Item& item = m_items[i];
+            const float basis = (item.basis >= 0) ? item.basis : (row ? item.naturalSize.x : item.naturalSize.y);
+            if (row)
+            {
+                m_measurements[i].hypotheticalMainSize = clampSize(basis, item.minimumSize.x, item.maximumSize.x);
+                m_measurements[i].crossSize = clampSize(item.naturalSize.y, item.minimumSize.y, item.maximumSize.y);
+            }
+            else
+            {
+                m_measurements[i].hypotheticalMainSize = clampSize(basis, item.minimumSize.y, item.maximumSize.y);
+                m_measurements[i].crossSize = clampSize(item.naturalSize.x, item.minimumSize.x, item.maximumSize.x);
+            }
+        }
+
+        m_measurementsValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::resolveFlexibleLengths(std::size_t first, std::size_t last, float availableSpace)
+    {
+        const bool row = (m_direction == Direction::Row);
+        const float spaceBetweenWidgets = m_spaceBetweenWidgetsCached * (last - first - 1);
+
+        float usedSpace = spaceBetweenWidgets;
+        for (std::size_t i = first; i < last; ++i)
+            usedSpace += m_measurements[i].hypotheticalMainSize;
+
+        // Widgets that can't change in the required direction keep their basis
+        const bool growing = (usedSpace < availableSpace);
+        for (std::size_t i = first; i < last; ++i)
+        {
+            m_measurements[i].mainSize = m_measurements[i].hypotheticalMainSize;
+            m_measurements[i].frozen = growing ? (m_items[i].grow == 0) : (m_items[i].shrink == 0);
+        }
+
+        // Distribute the free space, and try again without the widgets that reached their minimum or maximum size
+        while (true)
+        {
+            float freeSpace = availableSpace - spaceBetweenWidgets;
+            float totalFactor = 0;
+            for (std::size_t i = first; i < last; ++i)
+            {
+                if (m_measurements[i].frozen)
+                    freeSpace -= m_measurements[i].mainSize;
+                else
+                {
+                    freeSpace -= m_measurements[i].hypotheticalMainSize;
+                    totalFactor += growing ? m_items[i].grow : m_items[i].shrink * m_measurements[i].hypotheticalMainSize;
+                }
+            }
+
+            if (totalFactor <= 0)
+                break;
+
+            float totalViolation = 0;
+            for (std::size_t i = first; i < last; ++i)
+            {
+                if (m_measurements[i].frozen)
+                    continue;
+
+                const float factor = growing ? m_items[i].grow : m_items[i].shrink * m_measurements[i].hypotheticalMainSize;
+                const float targetSize = m_measurements[i].hypotheticalMainSize + freeSpace * factor / totalFactor;
+                const float clampedSize = std::max(0.f, clampSize(targetSize, row ? m_items[i].minimumSize.x : m_items[i].minimumSize.y,
+                                                                  row ? m_items[i].maximumSize.x : m_items[i].maximumSize.y));
+                m_measurements[i].mainSize = clampedSize;
+                totalViolation += clampedSize - targetSize;
+            }
+
+            if (totalViolation == 0)
+                break;
+
+            // Freeze the widgets that were clamped in the direction of the total violation
+            bool widgetFrozen = false;
+            for (std::size_t i = first; i < last; ++i)
+            {
+                if (m_measurements[i].frozen)
+                    continue;
+
+                const float factor = growing ? m_items[i].grow : m_items[i].shrink * m_measurements[i].hypotheticalMainSize;
+                const float targetSize = m_measurements[i].hypotheticalMainSize + freeSpace * factor / totalFactor;
+                if (((totalViolation > 0) && (m_measurements[i].mainSize > targetSize))
+                 || ((totalViolation < 0) && (m_measurements[i].mainSize < targetSize)))
+                {
+                    m_measurements[i].frozen = true;
+                    widgetFrozen = true;
+                }
+            }
+
+            if (!widgetFrozen)
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::invalidateMeasurements()
+    {
+        m_measurementsValid = false;
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,12 +26,40 @@
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Ends the batch of changes that load started when loading fails. Arranging the partially loaded widgets may throw
+        // as well, but that exception can't replace the one that is already being thrown.
+        struct EndUpdateOnFailure
+        {
+            Grid* grid;
+
+            ~EndUpdateOnFailure()
+            {
+                if (!grid)
+                    return;
+
+                try
+                {
+                    grid->endUpdate();
+                }
+                catch (...)
+                {
+                }
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Grid::Grid()
     {
         m_type = "Grid";
@@ -43,6 +71,8 @@ namespace tgui
         Container {gridToCopy},
         m_autoSize{gridToCopy.m_autoSize}
     {
+        beginUpdate();
+
         for (std::size_t row = 0; row < gridToCopy.m_gridWidgets.size(); ++row)
         {
             for (std::size_t col = 0; col < gridToCopy.m_gridWidgets[row].size(); ++col)
@@ -56,6 +86,8 @@ namespace tgui
                 }
             }
         }
+
+        endUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,12 +100,16 @@ namespace tgui
         m_objAlignment      {std::move(gridToMove.m_objAlignment)},
         m_rowHeight         {std::move(gridToMove.m_rowHeight)},
         m_columnWidth       {std::move(gridToMove.m_columnWidth)},
+        m_rowPositions      {std::move(gridToMove.m_rowPositions)},
+        m_columnPositions   {std::move(gridToMove.m_columnPositions)},
+        m_widgetCells       {std::move(gridToMove.m_widgetCells)},
         m_connectedCallbacks{}
     {
         for (auto& widget : m_widgets)
         {
+            const Widget* widgetPtr = widget.get();
             widget->disconnect(gridToMove.m_connectedCallbacks[widget]);
-            m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+            m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this,widgetPtr](){ widgetSizeChanged(widgetPtr); });
         }
     }
 
@@ -87,7 +123,9 @@ namespace tgui
             Container::operator=(right);
             m_autoSize = right.m_autoSize;
             m_connectedCallbacks.clear();
+            m_widgetCells.clear();
 
+            beginUpdate();
             for (std::size_t row = 0; row < right.m_gridWidgets.size(); ++row)
             {
                 for (std::size_t col = 0; col < right.m_gridWidgets[row].size(); ++col)
@@ -101,6 +139,7 @@ namespace tgui
                     }
                 }
             }
+            endUpdate();
         }
 
         return *this;
@@ -119,12 +158,16 @@ namespace tgui
             m_objAlignment       = std::move(right.m_objAlignment);
             m_rowHeight          = std::move(right.m_rowHeight);
             m_columnWidth        = std::move(right.m_columnWidth);
+            m_rowPositions       = std::move(right.m_rowPositions);
+            m_columnPositions    = std::move(right.m_columnPositions);
+            m_widgetCells        = std::move(right.m_widgetCells);
             m_connectedCallbacks = std::move(right.m_connectedCallbacks);
 
             for (auto& widget : m_widgets)
             {
-                widget->disconnect(right.m_connectedCallbacks[widget]);
-                m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+                const Widget* widgetPtr = widget.get();
+                widget->disconnect(m_connectedCallbacks[widget]);
+                m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this,widgetPtr](){ widgetSizeChanged(widgetPtr); });
             }
         }
 
@@ -188,50 +231,82 @@ namespace tgui
             m_connectedCallbacks.erase(callbackIt);
         }
 
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        const auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
         {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+            const std::size_t row = cellIt->second.first;
+            const std::size_t col = cellIt->second.second;
+            m_widgetCells.erase(cellIt);
+
+            // Remove the widget from the grid
+            m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
+            m_objPadding[row].erase(m_objPadding[row].begin() + col);
+            m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
+
+            // Check if this is the last column
+            if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
             {
-                if (m_gridWidgets[row][col] == widget)
+                // Check if there is another row with this many columns
+                bool rowFound = false;
+                for (std::size_t i = 0; i < m_gridWidgets.size(); ++i)
                 {
-                    // Remove the widget from the grid
-                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
-                    m_objPadding[row].erase(m_objPadding[row].begin() + col);
-                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
-
-                    // Check if this is the last column
-                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
+                    if (m_gridWidgets[i].size() >= m_columnWidth.size())
                     {
-                        // Check if there is another row with this many columns
-                        bool rowFound = false;
-                        for (std::size_t i = 0; i < m_gridWidgets.size(); ++i)
-                        {
-                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
-                            {
-                                rowFound = true;
-                                break;
-                            }
-                        }
-
-                        // Erase the last column if no other row is using it
-                        if (!rowFound)
-                            m_columnWidth.erase(m_columnWidth.end()-1);
+                        rowFound = true;
+                        break;
                     }
+                }
+
+                // Erase the last column if no other row is using it
+                if (!rowFound)
+                    m_columnWidth.erase(m_columnWidth.end()-1);
+            }
+
+            // The widgets behind the removed one moved one column to the left
+            for (std::size_t i = col; i < m_gridWidgets[row].size(); ++i)
+            {
+                if (m_gridWidgets[row][i])
+                    m_widgetCells[m_gridWidgets[row][i].get()] = {row, i};
+            }
+
+            // If the row is empty then remove it as well
+            const bool rowRemoved = m_gridWidgets[row].empty();
+            if (rowRemoved)
+            {
+                m_gridWidgets.erase(m_gridWidgets.begin() + row);
+                m_objPadding.erase(m_objPadding.begin() + row);
+                m_objAlignment.erase(m_objAlignment.begin() + row);
+                m_rowHeight.erase(m_rowHeight.begin() + row);
 
-                    // If the row is empty then remove it as well
-                    if (m_gridWidgets[row].empty())
+                for (std::size_t i = row; i < m_gridWidgets.size(); ++i)
+                {
+                    for (std::size_t j = 0; j < m_gridWidgets[i].size(); ++j)
                     {
-                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
-                        m_objPadding.erase(m_objPadding.begin() + row);
-                        m_objAlignment.erase(m_objAlignment.begin() + row);
-                        m_rowHeight.erase(m_rowHeight.begin() + row);
+                        if (m_gridWidgets[i][j])
+                            m_widgetCells[m_gridWidgets[i][j].get()] = {i, j};
                     }
-
-                    // Update the positions of all remaining widgets
-                    updatePositionsOfAllWidgets();
                 }
             }
+
+            if (m_updateDepth > 0)
+            {
+                // All rows and columns are recalculated when the batch ends
+                updateWidgets();
+            }
+            else
+            {
+                // The removed widget may have been the biggest one in its row, and the columns behind it now contain other widgets
+                if (!rowRemoved)
+                    updateRowHeight(row);
+                for (std::size_t i = col; i < m_columnWidth.size(); ++i)
+                    updateColumnWidth(i);
+
+                if (m_autoSize)
+                    updateAutoSize();
+
+                // Update the positions of all remaining widgets
+                updatePositionsOfAllWidgets();
+            }
         }
 
         return Container::remove(widget);
@@ -250,6 +325,7 @@ namespace tgui
         m_rowHeight.clear();
         m_columnWidth.clear();
 
+        m_widgetCells.clear();
         m_connectedCallbacks.clear();
 
         updateWidgets();
@@ -287,16 +363,30 @@ namespace tgui
         if (m_columnWidth.size() < col + 1)
             m_columnWidth.resize(col + 1, 0);
 
+        // A widget can only be located in a single cell, so it is removed from the cell where it was placed before.
+        // The widget that was placed in the cell before is no longer part of the grid.
+        const auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
+            m_gridWidgets[cellIt->second.first][cellIt->second.second] = nullptr;
+        if (m_gridWidgets[row][col])
+            m_widgetCells.erase(m_gridWidgets[row][col].get());
+
         // Add the widget to the grid
         m_gridWidgets[row][col] = widget;
         m_objPadding[row][col] = padding;
         m_objAlignment[row][col] = alignment;
+        m_widgetCells[widget.get()] = {row, col};
 
         // Update the widgets
         updateWidgets();
 
         // Automatically update the widgets when their size changes
-        m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+        const auto callbackIt = m_connectedCallbacks.find(widget);
+        if (callbackIt != m_connectedCallbacks.end())
+            widget->disconnect(callbackIt->second);
+
+        const Widget* widgetPtr = widget.get();
+        m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this,widgetPtr](){ widgetSizeChanged(widgetPtr); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,15 +404,8 @@ namespace tgui
     std::map<Widget::Ptr, std::pair<std::size_t, std::size_t>> Grid::getWidgetLocations() const
     {
         std::map<Widget::Ptr, std::pair<std::size_t, std::size_t>> widgetsMap;
-
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col])
-                    widgetsMap[m_gridWidgets[row][col]] = {row, col};
-            }
-        }
+        for (const auto& pair : m_widgetCells)
+            widgetsMap[m_gridWidgets[pair.second.first][pair.second.second]] = pair.second;
 
         return widgetsMap;
     }
@@ -331,15 +414,9 @@ namespace tgui
 
     void Grid::setWidgetPadding(const Widget::Ptr& widget, const Padding& padding)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetPadding(row, col, padding);
-            }
-        }
+        const auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
+            setWidgetPadding(cellIt->second.first, cellIt->second.second, padding);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,8 +428,8 @@ namespace tgui
             // Change padding of the widget
             m_objPadding[row][col] = padding;
 
-            // Update all widgets
-            updateWidgets();
+            // Update the row and column of the widget
+            cellChanged(row, col);
         }
     }
 
@@ -360,17 +437,11 @@ namespace tgui
 
     Padding Grid::getWidgetPadding(const Widget::Ptr& widget) const
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetPadding(row, col);
-            }
-        }
-
-        return {};
+        const auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
+            return getWidgetPadding(cellIt->second.first, cellIt->second.second);
+        else
+            return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,15 +458,9 @@ namespace tgui
 
     void Grid::setWidgetAlignment(const Widget::Ptr& widget, Alignment alignment)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetAlignment(row, col, alignment);
-            }
-        }
+        const auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
+            setWidgetAlignment(cellIt->second.first, cellIt->second.second, alignment);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,7 +470,12 @@ namespace tgui
         if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
         {
             m_objAlignment[row][col] = alignment;
-            updatePositionsOfAllWidgets();
+
+            // Only the widget itself moves inside its cell
+            if ((m_updateDepth > 0) || m_pendingWidgetsUpdate || m_pendingPositionsUpdate)
+                updatePositionsOfAllWidgets();
+            else
+                updatePositionOfWidget(row, col);
         }
     }
 
@@ -413,16 +483,11 @@ namespace tgui
 
     Grid::Alignment Grid::getWidgetAlignment(const Widget::Ptr& widget) const
     {
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetAlignment(row, col);
-            }
-        }
-
-        return Alignment::Center;
+        const auto cellIt = m_widgetCells.find(widget.get());
+        if (cellIt != m_widgetCells.end())
+            return getWidgetAlignment(cellIt->second.first, cellIt->second.second);
+        else
+            return Alignment::Center;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +509,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::beginUpdate()
+    {
+        ++m_updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::endUpdate()
+    {
+        if (m_updateDepth == 0)
+        {
+            TGUI_PRINT_WARNING("endUpdate called without matching beginUpdate.");
+            return;
+        }
+
+        --m_updateDepth;
+        if (m_updateDepth > 0)
+            return;
+
+        if (m_pendingWidgetsUpdate)
+            updateWidgets();
+        else if (m_pendingPositionsUpdate)
+            updatePositionsOfAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Grid::isUpdating() const
+    {
+        return m_updateDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Grid::mouseOnWidget(Vector2f pos) const
     {
         return FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
@@ -456,8 +555,7 @@ namespace tgui
         auto node = Container::save(renderers);
 
         const auto& children = getWidgets();
-        auto widgetsMap = getWidgetLocations();
-        if (!widgetsMap.empty())
+        if (!m_widgetCells.empty())
         {
             auto alignmentToString = [](Grid::Alignment alignment) -> std::string {
                 switch (alignment)
@@ -486,8 +584,8 @@ namespace tgui
             };
 
             auto getWidgetsInGridString = [&](const Widget::Ptr& w) -> std::string {
-                auto it = widgetsMap.find(w);
-                if (it != widgetsMap.end())
+                auto it = m_widgetCells.find(w.get());
+                if (it != m_widgetCells.end())
                 {
                     const auto row = it->second.first;
                     const auto col = it->second.second;
@@ -521,6 +619,10 @@ namespace tgui
 
     void Grid::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
     {
+        // Only calculate the rows and columns once, after all widgets were placed in the grid
+        beginUpdate();
+        EndUpdateOnFailure endUpdateOnFailure{this};
+
         Container::load(node, renderers);
 
         if (node->propertyValuePairs["autosize"])
@@ -615,6 +717,9 @@ namespace tgui
                 addWidget(getWidgets()[i], static_cast<std::size_t>(row), static_cast<std::size_t>(col), padding, alignment);
             }
         }
+
+        endUpdateOnFailure.grid = nullptr;
+        endUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +743,134 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::updatePositionsOfAllWidgets()
+    {
+        if (m_updateDepth > 0)
+        {
+            m_pendingPositionsUpdate = true;
+            return;
+        }
+
+        m_pendingPositionsUpdate = false;
+
+        calculateRowAndColumnPositions(m_rowPositions, m_columnPositions);
+
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+            {
+                if (m_gridWidgets[row][col])
+                    updatePositionOfWidget(row, col);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateWidgets()
+    {
+        if (m_updateDepth > 0)
+        {
+            m_pendingWidgetsUpdate = true;
+            return;
+        }
+
+        m_pendingWidgetsUpdate = false;
+
+        // Reset the column widths
+        for (float& width : m_columnWidth)
+            width = 0;
+
+        // Loop through all widgets
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            // Reset the row height
+            m_rowHeight[row] = 0;
+
+            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+            {
+                if (m_gridWidgets[row][col].get() == nullptr)
+                    continue;
+
+                // Remember the biggest column width and row height
+                const Vector2f cellSize = getRequiredCellSize(row, col);
+                m_columnWidth[col] = std::max(m_columnWidth[col], cellSize.x);
+                m_rowHeight[row] = std::max(m_rowHeight[row], cellSize.y);
+            }
+        }
+
+        if (m_autoSize)
+            updateAutoSize();
+
+        updatePositionsOfAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f Grid::getRequiredCellSize(std::size_t row, std::size_t col) const
+    {
+        const Padding& padding = m_objPadding[row][col];
+        const Vector2f widgetSize = m_gridWidgets[row][col]->getFullSize();
+        return {widgetSize.x + padding.getLeft() + padding.getRight(), widgetSize.y + padding.getTop() + padding.getBottom()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Grid::updateRowHeight(std::size_t row)
+    {
+        float rowHeight = 0;
+        for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+        {
+            if (m_gridWidgets[row][col])
+                rowHeight = std::max(rowHeight, getRequiredCellSize(row, col).y);
+        }
+
+        if (rowHeight == m_rowHeight[row])
+            return false;
+
+        m_rowHeight[row] = rowHeight;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Grid::updateColumnWidth(std::size_t col)
+    {
+        float columnWidth = 0;
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            if ((col < m_gridWidgets[row].size()) && m_gridWidgets[row][col])
+                columnWidth = std::max(columnWidth, getRequiredCellSize(row, col).x);
+        }
+
+        if (columnWidth == m_columnWidth[col])
+            return false;
+
+        m_columnWidth[col] = columnWidth;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateAutoSize()
+    {
+        // The widest row is the one with the most columns, as the width of a column is never negative
+        Vector2f size;
+        std::size_t columnCount = 0;
+        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        {
+            columnCount = std::max(columnCount, m_gridWidgets[row].size());
+            size.y += m_rowHeight[row];
+        }
+
+        for (std::size_t col = 0; col < columnCount; ++col)
+            size.x += m_columnWidth[col];
+
+        Container::setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::calculateRowAndColumnPositions(std::vector<float>& rowPositions, std::vector<float>& columnPositions) const
     {
         Vector2f position;
 
@@ -663,123 +896,140 @@ namespace tgui
             }
         }
 
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        rowPositions.resize(m_rowHeight.size());
+        for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
         {
-            const Vector2f previousPosition = position;
+            rowPositions[row] = position.y;
+            position.y += m_rowHeight[row] + extraOffset.y;
+        }
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                {
-                    position.x += m_columnWidth[col] + extraOffset.x;
-                    continue;
-                }
+        columnPositions.resize(m_columnWidth.size());
+        for (std::size_t col = 0; col < m_columnWidth.size(); ++col)
+        {
+            columnPositions[col] = position.x;
+            position.x += m_columnWidth[col] + extraOffset.x;
+        }
+    }
 
-                Vector2f cellPosition = position;
-                switch (m_objAlignment[row][col])
-                {
-                case Alignment::UpperLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
-
-                case Alignment::Up:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
-
-                case Alignment::UpperRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
-
-                case Alignment::Right:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-
-                case Alignment::BottomRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::Bottom:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::BottomLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
-
-                case Alignment::Left:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-
-                case Alignment::Center:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                m_gridWidgets[row][col]->setPosition(cellPosition);
-                position.x += m_columnWidth[col] + extraOffset.x;
-            }
+    void Grid::updatePositionOfWidget(std::size_t row, std::size_t col)
+    {
+        const Widget::Ptr& widget = m_gridWidgets[row][col];
+        const Padding& padding = m_objPadding[row][col];
 
-            // Move to the next row
-            position = previousPosition;
-            position.y += m_rowHeight[row] + extraOffset.y;
+        Vector2f cellPosition{m_columnPositions[col], m_rowPositions[row]};
+        switch (m_objAlignment[row][col])
+        {
+        case Alignment::UpperLeft:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::Up:
+            cellPosition.x += padding.getLeft() + (((m_columnWidth[col] - padding.getLeft() - padding.getRight()) - widget->getFullSize().x) / 2.f);
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::UpperRight:
+            cellPosition.x += m_columnWidth[col] - padding.getRight() - widget->getFullSize().x;
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::Right:
+            cellPosition.x += m_columnWidth[col] - padding.getRight() - widget->getFullSize().x;
+            cellPosition.y += padding.getTop() + (((m_rowHeight[row] - padding.getTop() - padding.getBottom()) - widget->getFullSize().y) / 2.f);
+            break;
+
+        case Alignment::BottomRight:
+            cellPosition.x += m_columnWidth[col] - padding.getRight() - widget->getFullSize().x;
+            cellPosition.y += m_rowHeight[row] - padding.getBottom() - widget->getFullSize().y;
+            break;
+
+        case Alignment::Bottom:
+            cellPosition.x += padding.getLeft() + (((m_columnWidth[col] - padding.getLeft() - padding.getRight()) - widget->getFullSize().x) / 2.f);
+            cellPosition.y += m_rowHeight[row] - padding.getBottom() - widget->getFullSize().y;
+            break;
+
+        case Alignment::BottomLeft:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += m_rowHeight[row] - padding.getBottom() - widget->getFullSize().y;
+            break;
+
+        case Alignment::Left:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += padding.getTop() + (((m_rowHeight[row] - padding.getTop() - padding.getBottom()) - widget->getFullSize().y) / 2.f);
+            break;
+
+        case Alignment::Center:
+            cellPosition.x += padding.getLeft() + (((m_columnWidth[col] - padding.getLeft() - padding.getRight()) - widget->getFullSize().x) / 2.f);
+            cellPosition.y += padding.getTop() + (((m_rowHeight[row] - padding.getTop() - padding.getBottom()) - widget->getFullSize().y) / 2.f);
+            break;
         }
+
+        widget->setPosition(cellPosition);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Grid::updateWidgets()
+    void Grid::cellChanged(std::size_t row, std::size_t col)
     {
-        // Reset the column widths
-        for (float& width : m_columnWidth)
-            width = 0;
+        // When the rows and columns are already going to be recalculated, there is no point in updating a single cell
+        if ((m_updateDepth > 0) || m_pendingWidgetsUpdate || m_pendingPositionsUpdate
+         || (m_rowPositions.size() != m_rowHeight.size()) || (m_columnPositions.size() != m_columnWidth.size()))
+        {
+            updateWidgets();
+            return;
+        }
 
-        // Loop through all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        const bool rowChanged = updateRowHeight(row);
+        const bool columnChanged = updateColumnWidth(col);
+        if (!rowChanged && !columnChanged)
         {
-            // Reset the row height
-            m_rowHeight[row] = 0;
+            updatePositionOfWidget(row, col);
+            return;
+        }
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                    continue;
+        if (m_autoSize)
+            updateAutoSize();
 
-                // Remember the biggest column width
-                if (m_columnWidth[col] < m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight())
-                    m_columnWidth[col] = m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight();
+        // Only the widgets of which the row or column moved or changed size have to be placed again
+        std::vector<float> rowPositions;
+        std::vector<float> columnPositions;
+        calculateRowAndColumnPositions(rowPositions, columnPositions);
 
-                // Remember the biggest row height
-                if (m_rowHeight[row] < m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom())
-                    m_rowHeight[row] = m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom();
-            }
+        bool anyColumnChanged = false;
+        std::vector<bool> changedColumns(columnPositions.size());
+        for (std::size_t i = 0; i < columnPositions.size(); ++i)
+        {
+            changedColumns[i] = (columnPositions[i] != m_columnPositions[i]) || (columnChanged && (i == col));
+            anyColumnChanged = anyColumnChanged || changedColumns[i];
         }
 
-        if (m_autoSize)
+        m_rowPositions.swap(rowPositions);
+        m_columnPositions.swap(columnPositions);
+
+        for (std::size_t i = 0; i < m_gridWidgets.size(); ++i)
         {
-            Vector2f size;
-            for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-            {
-                float rowWidth = 0;
-                for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-                    rowWidth += m_columnWidth[col];
+            const bool changedRow = (m_rowPositions[i] != rowPositions[i]) || (rowChanged && (i == row));
+            if (!changedRow && !anyColumnChanged)
+                continue;
 
-                size.x = std::max(size.x, rowWidth);
-                size.y += m_rowHeight[row];
+            for (std::size_t j = 0; j < m_gridWidgets[i].size(); ++j)
+            {
+                if (m_gridWidgets[i][j] && (changedRow || changedColumns[j]))
+                    updatePositionOfWidget(i, j);
             }
-
-            Container::setSize(size);
         }
+    }
 
-        updatePositionsOfAllWidgets();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::widgetSizeChanged(const Widget* widget)
+    {
+        const auto cellIt = m_widgetCells.find(widget);
+        if (cellIt != m_widgetCells.end())
+            cellChanged(cellIt->second.first, cellIt->second.second);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,9 @@
 
 #include <TGUI/Widgets/HorizontalWrap.hpp>
 
+#include <algorithm>
+#include <limits>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -59,32 +62,167 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void HorizontalWrap::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        widgetsChangedFrom(std::min(index, m_widgets.size()));
+        BoxLayout::insert(index, widget, widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool HorizontalWrap::remove(std::size_t index)
+    {
+        if (index < m_widgets.size())
+            widgetsChangedFrom(index);
+
+        return BoxLayout::remove(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::removeAllWidgets()
+    {
+        widgetsChangedFrom(0);
+        BoxLayout::removeAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::childWidgetBoundsChanged(const Widget* child)
+    {
+        BoxLayout::childWidgetBoundsChanged(child);
+
+        // Only a change in size influences where the widgets are placed
+        if (m_placingWidgets)
+            return;
+
+        for (std::size_t i = 0; i < std::min(m_widgets.size(), m_placedSizes.size()); ++i)
+        {
+            if (m_widgets[i].get() == child)
+            {
+                if (child->getSize() != m_placedSizes[i])
+                    widgetsChangedFrom(i);
+
+                break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void HorizontalWrap::updateWidgets()
     {
-        const Vector2f contentSize = {getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
-                                          getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
+        const float contentWidth = getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        const float space = m_spaceBetweenWidgetsCached;
 
-        float currentHorizontalOffset = 0;
+        // Find the first line that may change. The lines above it keep the same widgets at the same positions.
+        std::size_t firstLine = 0;
+        if (!m_lines.empty() && (space == m_placedSpaceBetweenWidgets) && !m_firstWidgetOnSecondLine)
+        {
+            firstLine = m_lines.size();
+
+            // A line keeps its widgets as long as they still fit and the next widget still doesn't fit. As the lines store the
+            // largest and smallest of these widths of all lines above them, a binary search finds the first line that changes.
+            if (contentWidth != m_placedWidth)
+            {
+                firstLine = static_cast<std::size_t>(std::partition_point(m_lines.begin(), m_lines.end(), [contentWidth](const Line& line){
+                        return (line.maxWidth <= contentWidth) && (contentWidth < line.minNextWidth);
+                    }) - m_lines.begin());
+            }
+
+            // Whether a widget still fits in a line also depends on the widget in front of it
+            if (m_firstChangedWidget < std::numeric_limits<std::size_t>::max())
+            {
+                const std::size_t widgetIndex = (m_firstChangedWidget > 0) ? (m_firstChangedWidget - 1) : 0;
+                const auto lineIt = std::upper_bound(m_lines.begin(), m_lines.end(), widgetIndex, [](std::size_t index, const Line& line){ return index < line.firstWidget; });
+                firstLine = std::min(firstLine, static_cast<std::size_t>(lineIt - m_lines.begin()) - 1);
+            }
+        }
+
+        m_placedWidth = contentWidth;
+        m_placedSpaceBetweenWidgets = space;
+        m_firstChangedWidget = std::numeric_limits<std::size_t>::max();
+        if (!m_lines.empty() && (firstLine >= m_lines.size()))
+            return;
+
+        std::size_t firstWidget = 0;
         float currentVerticalOffset = 0;
+        if (firstLine > 0)
+        {
+            firstWidget = m_lines[firstLine].firstWidget;
+            currentVerticalOffset = m_lines[firstLine].top;
+        }
+        else
+            m_firstWidgetOnSecondLine = false;
+
+        m_lines.resize(firstLine);
+        m_placedSizes.resize(m_widgets.size());
+
+        const auto finishLine = [this](float lineWidth, float nextWidth)
+            {
+                Line& line = m_lines.back();
+                line.maxWidth = lineWidth;
+                line.minNextWidth = nextWidth;
+                if (m_lines.size() > 1)
+                {
+                    const Line& previousLine = m_lines[m_lines.size() - 2];
+                    line.maxWidth = std::max(line.maxWidth, previousLine.maxWidth);
+                    line.minNextWidth = std::min(line.minNextWidth, previousLine.minNextWidth);
+                }
+            };
+
+        m_placingWidgets = true;
+
+        float currentHorizontalOffset = 0;
         float lineHeight = 0;
-        for (const auto& widget : m_widgets)
+        float lineWidth = 0;
+        for (std::size_t i = firstWidget; i < m_widgets.size(); ++i)
         {
-            const auto size = widget->getSize();
+            const auto size = m_widgets[i]->getSize();
 
-            if (currentHorizontalOffset + size.x > contentSize.x)
+            if (i == firstWidget)
             {
-                currentVerticalOffset += lineHeight + m_spaceBetweenWidgetsCached;
+                // When the first widget doesn't fit, an empty line is placed above it
+                if ((i == 0) && (size.x > contentWidth))
+                {
+                    currentVerticalOffset += space;
+                    m_firstWidgetOnSecondLine = true;
+                }
+
+                m_lines.push_back({i, currentVerticalOffset, 0, 0});
+            }
+            else if (currentHorizontalOffset + size.x > contentWidth)
+            {
+                finishLine(lineWidth, currentHorizontalOffset + size.x);
+
+                currentVerticalOffset += lineHeight + space;
                 currentHorizontalOffset = 0;
                 lineHeight = 0;
+
+                m_lines.push_back({i, currentVerticalOffset, 0, 0});
             }
 
-            widget->setPosition({currentHorizontalOffset, currentVerticalOffset});
+            m_widgets[i]->setPosition({currentHorizontalOffset, currentVerticalOffset});
+            m_placedSizes[i] = size;
 
-            currentHorizontalOffset += size.x + m_spaceBetweenWidgetsCached;
+            lineWidth = currentHorizontalOffset + size.x;
+            currentHorizontalOffset += size.x + space;
 
             if (lineHeight < size.y)
                 lineHeight = size.y;
         }
+
+        if (!m_lines.empty())
+            finishLine(lineWidth, std::numeric_limits<float>::infinity());
+
+        m_placingWidgets = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::widgetsChangedFrom(std::size_t index)
+    {
+        m_firstChangedWidget = std::min(m_firstChangedWidget, index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
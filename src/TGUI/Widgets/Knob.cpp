@@ -464,8 +464,12 @@ namespace tgui
 
     Signal& Knob::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const internal_signal::SignalTable<Knob> signals{*this, {
+                [](Knob& knob) -> Signal& { return knob.onValueChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -307,6 +307,7 @@ namespace tgui
                 {
                     m_animationTimeElapsed = {};
                     m_possibleDoubleClick = true;
+                    scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
                 }
             }
             else // Mouse didn't go down on the label, so this isn't considered a click
@@ -368,8 +369,12 @@ namespace tgui
 
     Signal& Label::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const internal_signal::SignalTable<Label> signals{*this, {
+                [](Label& label) -> Signal& { return label.onDoubleClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
@@ -564,6 +569,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,40 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
+#include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Time after the last typed character before the type-ahead text is forgotten
+        const sf::Time typeAheadTimeout = sf::milliseconds(1000);
+
+        // Converts the string to lowercase so that items can be compared case-insensitively (only ASCII letters are converted)
+        sf::String toLowerCase(sf::String str)
+        {
+            for (auto& c : str)
+            {
+                if ((c >= 'A') && (c <= 'Z'))
+                    c += 'a' - 'A';
+            }
+
+            return str;
+        }
+
+        // Checks whether the (already lowercase) string starts with the given (already lowercase) prefix
+        bool startsWith(const sf::String& str, const sf::String& prefix)
+        {
+            if (str.getSize() < prefix.getSize())
+                return false;
+
+            return std::equal(prefix.begin(), prefix.end(), str.begin());
+        }
+    }
+
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
@@ -98,9 +127,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
-
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
 
@@ -134,18 +160,12 @@ namespace tgui
             if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
+            // Add the new item to the list. The text object is only created once the item becomes visible.
+            m_itemIdIndex.emplace(id, m_items.size());
+            if (m_searchIndexEnabled)
+                m_searchIndex.emplace(toLowerCase(itemName), m_items.size());
+
+            m_items.push_back(itemName);
             m_itemIds.push_back(id);
             return true;
         }
@@ -157,11 +177,9 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -172,11 +190,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        const auto it = m_itemIdIndex.find(id);
+        if (it != m_itemIdIndex.end())
+            return setSelectedItemByIndex(it->second);
 
         // No match was found
         deselectItem();
@@ -215,11 +231,9 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -228,11 +242,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        const auto it = m_itemIdIndex.find(id);
+        if (it != m_itemIdIndex.end())
+            return removeItemByIndex(it->second);
 
         return false;
     }
@@ -257,11 +269,13 @@ namespace tgui
         }
 
         // Remove the item
+        removeFromSearchIndex(index);
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        rebuildItemIdIndex();
+        invalidateVisibleItems();
 
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
 
         return true;
     }
@@ -277,6 +291,9 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_itemIdIndex.clear();
+        m_searchIndex.clear();
+        invalidateVisibleItems();
 
         m_scroll->setMaximum(0);
     }
@@ -285,11 +302,9 @@ namespace tgui
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
+        const auto it = m_itemIdIndex.find(id);
+        if (it != m_itemIdIndex.end())
+            return m_items[it->second];
 
         return "";
     }
@@ -301,14 +316,14 @@ namespace tgui
         if (index >= m_items.size())
             return "";
 
-        return m_items[index].getString();
+        return m_items[index];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? m_items[m_selectedItem] : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,11 +344,9 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = findItemIndex(originalValue);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -342,11 +355,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const auto it = m_itemIdIndex.find(id);
+        if (it != m_itemIdIndex.end())
+            return changeItemByIndex(it->second, newValue);
 
         return false;
     }
@@ -358,7 +369,22 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
-        m_items[index].setString(newValue);
+        if (m_searchIndexEnabled)
+        {
+            eraseFromSearchIndex(index);
+            m_searchIndex.emplace(toLowerCase(newValue), index);
+        }
+
+        m_items[index] = newValue;
+
+        // Only the text object of a visible item needs to be updated
+        if (m_visibleItemsValid && (index >= m_firstVisibleItem) && (index < m_firstVisibleItem + m_visibleItems.size()))
+        {
+            Text& text = m_visibleItems[index - m_firstVisibleItem];
+            text.setString(newValue);
+            text.setPosition({0, (index * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+        }
+
         return true;
     }
 
@@ -373,11 +399,7 @@ namespace tgui
 
     std::vector<sf::String> ListBox::getItems() const
     {
-        std::vector<sf::String> items;
-        for (const auto& item : m_items)
-            items.push_back(item.getString());
-
-        return items;
+        return m_items;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -394,11 +416,9 @@ namespace tgui
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.setCharacterSize(m_textSize);
-        }
+
+        invalidateVisibleItems();
 
         m_scroll->setScrollAmount(m_itemHeight);
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
@@ -423,9 +443,7 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.setCharacterSize(m_textSize);
-
+        invalidateVisibleItems();
         setPosition(m_position);
     }
 
@@ -449,6 +467,9 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            rebuildItemIdIndex();
+            rebuildSearchIndex();
+            invalidateVisibleItems();
 
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
             setPosition(m_position);
@@ -480,14 +501,90 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return findItemIndex(item) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return m_itemIdIndex.find(id) != m_itemIdIndex.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setSearchIndexEnabled(bool enabled)
+    {
+        m_searchIndexEnabled = enabled;
+        rebuildSearchIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isSearchIndexEnabled() const
+    {
+        return m_searchIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListBox::findItemsWithPrefix(const sf::String& prefix, std::size_t maxResults) const
+    {
+        const sf::String lowercasePrefix = toLowerCase(prefix);
+
+        std::vector<std::size_t> indices;
+        if (m_searchIndexEnabled)
+        {
+            // All items that start with the prefix are stored next to each other in the index, but sorted alphabetically.
+            // When the amount of results is limited, only the lowest indices are kept in a max-heap while looking at the matches.
+            for (auto it = m_searchIndex.lower_bound(lowercasePrefix); (it != m_searchIndex.end()) && startsWith(it->first, lowercasePrefix); ++it)
+            {
+                if (maxResults == 0)
+                    indices.push_back(it->second);
+                else if (indices.size() < maxResults)
+                {
+                    indices.push_back(it->second);
+                    std::push_heap(indices.begin(), indices.end());
+                }
+                else if (it->second < indices.front())
+                {
+                    std::pop_heap(indices.begin(), indices.end());
+                    indices.back() = it->second;
+                    std::push_heap(indices.begin(), indices.end());
+                }
+            }
+
+            // Return the matches in the same order as when searching without the index
+            std::sort(indices.begin(), indices.end());
+        }
+        else
+        {
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                if ((maxResults > 0) && (indices.size() >= maxResults))
+                    break;
+
+                if (startsWith(toLowerCase(m_items[i]), lowercasePrefix))
+                    indices.push_back(i);
+            }
+        }
+
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setTypeAheadEnabled(bool enabled)
+    {
+        m_typeAheadEnabled = enabled;
+        m_typeAheadText.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isTypeAheadEnabled() const
+    {
+        return m_typeAheadEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -543,7 +640,7 @@ namespace tgui
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem], m_hoveringItem);
+                    onMousePress.emit(this, m_items[m_hoveringItem], m_itemIds[m_hoveringItem], m_hoveringItem);
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -562,7 +659,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                onMouseRelease.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -570,12 +667,13 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                    onDoubleClick.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
             }
             else // This is the first click
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
             }
         }
 
@@ -630,6 +728,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::textEntered(std::uint32_t key)
+    {
+        if (!m_typeAheadEnabled)
+            return;
+
+        const int item = findTypeAheadItem(key);
+        if (item >= 0)
+            setSelectedItemByIndex(static_cast<std::size_t>(item));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time ListBox::getRemainingTypeAheadTime() const
+    {
+        if (m_typeAheadText.isEmpty())
+            return {};
+
+        return typeAheadTimeout - m_typeAheadTimeElapsed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListBox::mouseWheelScrolled(float delta, Vector2f pos)
     {
         if (m_scroll->isShown())
@@ -668,14 +788,15 @@ namespace tgui
 
     Signal& ListBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const internal_signal::SignalTable<ListBox> signals{*this, {
+                [](ListBox& listBox) -> Signal& { return listBox.onItemSelect; },
+                [](ListBox& listBox) -> Signal& { return listBox.onMousePress; },
+                [](ListBox& listBox) -> Signal& { return listBox.onMouseRelease; },
+                [](ListBox& listBox) -> Signal& { return listBox.onDoubleClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -721,24 +842,12 @@ namespace tgui
         else if (property == "textstyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+            invalidateVisibleItems();
         }
         else if (property == "selectedtextstyle")
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+            updateItemColorAndStyle(m_selectedItem);
         }
         else if (property == "scrollbar")
         {
@@ -783,24 +892,18 @@ namespace tgui
 
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
+            for (auto& item : m_visibleItems)
                 item.setOpacity(m_opacityCached);
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
-            {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
-            }
 
+            invalidateVisibleItems();
             setPosition(m_position);
         }
         else
@@ -909,37 +1012,111 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    void ListBox::updateItemColorsAndStyle()
     {
-        if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+        if (!m_visibleItemsValid)
+            return;
 
-            if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-        }
+        for (std::size_t i = 0; i < m_visibleItems.size(); ++i)
+            updateTextColorAndStyle(m_visibleItems[i], m_firstVisibleItem + i);
+    }
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
-        {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemColorAndStyle(int item)
+    {
+        if (!m_visibleItemsValid || (item < static_cast<int>(m_firstVisibleItem)))
+            return;
+
+        const std::size_t index = static_cast<std::size_t>(item);
+        if (index < m_firstVisibleItem + m_visibleItems.size())
+            updateTextColorAndStyle(m_visibleItems[index - m_firstVisibleItem], index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    void ListBox::updateTextColorAndStyle(Text& text, std::size_t item) const
     {
-        for (auto& item : m_items)
+        const bool selected = (static_cast<int>(item) == m_selectedItem);
+        const bool hovered = (static_cast<int>(item) == m_hoveringItem);
+
+        if (selected && hovered && m_selectedTextColorHoverCached.isSet())
+            text.setColor(m_selectedTextColorHoverCached);
+        else if (selected && m_selectedTextColorCached.isSet())
+            text.setColor(m_selectedTextColorCached);
+        else if (hovered && m_textColorHoverCached.isSet())
+            text.setColor(m_textColorHoverCached);
+        else
+            text.setColor(m_textColorCached);
+
+        if (selected && m_selectedTextStyleCached.isSet())
+            text.setStyle(m_selectedTextStyleCached);
+        else
+            text.setStyle(m_textStyleCached);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const
+    {
+        lastItem = std::min(lastItem, m_items.size());
+        firstItem = std::min(firstItem, lastItem);
+
+        if (m_visibleItemsValid && (firstItem == m_firstVisibleItem) && (lastItem - firstItem == m_visibleItems.size()))
+            return;
+
+        // Items that were already visible keep their text object, the other text objects are recycled for the newly visible items
+        const std::size_t oldFirstItem = m_firstVisibleItem;
+        const std::size_t oldLastItem = m_visibleItemsValid ? m_firstVisibleItem + m_visibleItems.size() : m_firstVisibleItem;
+        const auto isReused = [=](std::size_t item){ return (item >= firstItem) && (item < lastItem) && (item >= oldFirstItem) && (item < oldLastItem); };
+
+        std::vector<Text> oldItems;
+        oldItems.swap(m_visibleItems);
+        m_visibleItems.reserve(lastItem - firstItem);
+
+        std::size_t nextRecycledItem = 0;
+        for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            item.setColor(m_textColorCached);
-            item.setStyle(m_textStyleCached);
+            if (isReused(i))
+            {
+                m_visibleItems.push_back(std::move(oldItems[i - oldFirstItem]));
+                continue;
+            }
+
+            while ((nextRecycledItem < oldItems.size()) && isReused(oldFirstItem + nextRecycledItem))
+                ++nextRecycledItem;
+
+            Text text;
+            if (nextRecycledItem < oldItems.size())
+                text = std::move(oldItems[nextRecycledItem++]);
+
+            text.setFont(m_fontCached);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSize);
+            updateTextColorAndStyle(text, i);
+            text.setString(m_items[i]);
+            text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+            m_visibleItems.push_back(std::move(text));
         }
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        m_firstVisibleItem = firstItem;
+        m_visibleItemsValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::invalidateVisibleItems()
+    {
+        m_visibleItemsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::rebuildItemIdIndex()
+    {
+        m_itemIdIndex.clear();
+        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
+            m_itemIdIndex.emplace(m_itemIds[i], i);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -948,17 +1125,11 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
-                else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
-            }
-
+            const int oldHoveringItem = m_hoveringItem;
             m_hoveringItem = item;
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+            updateItemColorAndStyle(oldHoveringItem);
+            updateItemColorAndStyle(m_hoveringItem);
         }
     }
 
@@ -968,24 +1139,130 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
+            const int oldSelectedItem = m_selectedItem;
+            m_selectedItem = item;
 
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+            updateItemColorAndStyle(oldSelectedItem);
+            updateItemColorAndStyle(m_selectedItem);
 
-            m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem], m_selectedItem);
+                onItemSelect.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem], m_selectedItem);
             else
                 onItemSelect.emit(this, "", "", m_selectedItem);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+    void ListBox::rebuildSearchIndex()
+    {
+        m_searchIndex.clear();
+        if (!m_searchIndexEnabled)
+            return;
+
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            m_searchIndex.emplace_hint(m_searchIndex.end(), toLowerCase(m_items[i]), i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::eraseFromSearchIndex(std::size_t index)
+    {
+        const auto range = m_searchIndex.equal_range(toLowerCase(m_items[index]));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == index)
+            {
+                m_searchIndex.erase(it);
+                return;
+            }
+        }
+
+        assert(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::removeFromSearchIndex(std::size_t index)
+    {
+        if (!m_searchIndexEnabled)
+            return;
+
+        eraseFromSearchIndex(index);
+
+        // The items behind the removed item move one place up. Their entries are looked up by their text, unless so many items
+        // follow that walking over the entire index once is cheaper than all these lookups.
+        const std::size_t movedItemCount = m_items.size() - index - 1;
+        if (movedItemCount * 8 < m_searchIndex.size())
+        {
+            for (std::size_t i = index + 1; i < m_items.size(); ++i)
+            {
+                const auto range = m_searchIndex.equal_range(toLowerCase(m_items[i]));
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == i)
+                    {
+                        --it->second;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (auto& pair : m_searchIndex)
+            {
+                if (pair.second > index)
+                    --pair.second;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemIndex(const sf::String& item) const
+    {
+        if (m_searchIndexEnabled)
+        {
+            // Items with the same lowercase text are stored together, pick the first one that matches exactly
+            int index = -1;
+            const auto range = m_searchIndex.equal_range(toLowerCase(item));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if ((m_items[it->second] == item) && ((index < 0) || (it->second < static_cast<std::size_t>(index))))
+                    index = static_cast<int>(it->second);
+            }
+
+            return index;
         }
+        else
+        {
+            const auto it = std::find(m_items.begin(), m_items.end(), item);
+            if (it != m_items.end())
+                return static_cast<int>(it - m_items.begin());
+            else
+                return -1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findTypeAheadItem(std::uint32_t key)
+    {
+        // Ignore control characters
+        if (key < 32)
+            return -1;
+
+        // The text is forgotten in the update function when the previous character was typed too long ago
+        m_typeAheadText += key;
+        m_typeAheadTimeElapsed = {};
+        scheduleUpdate(typeAheadTimeout);
+
+        const auto items = findItemsWithPrefix(m_typeAheadText, 1);
+        if (!items.empty())
+            return static_cast<int>(items[0]);
+        else
+            return -1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -999,6 +1276,17 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
+
+        if (!m_typeAheadText.isEmpty())
+        {
+            m_typeAheadTimeElapsed += elapsedTime;
+            if (m_typeAheadTimeElapsed >= typeAheadTimeout)
+                m_typeAheadText.clear();
+            else
+                scheduleUpdate(typeAheadTimeout - m_typeAheadTimeElapsed);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1067,9 +1355,10 @@ namespace tgui
             }
 
             // Draw the items
+            updateVisibleItems(firstItem, lastItem);
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            for (const auto& item : m_visibleItems)
+                item.draw(target, states);
         }
 
         // Draw the scrollbar
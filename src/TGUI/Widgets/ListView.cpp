@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Clipping.hpp>
 #include <cmath>
+#include <numeric>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -144,6 +145,7 @@ namespace tgui
         if (m_columns[index].designWidth == 0)
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
+        updateAutoFitColumnWidths();
         updateHorizontalScrollbarMaximum();
     }
 
@@ -176,6 +178,7 @@ namespace tgui
         else
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
+        updateAutoFitColumnWidths();
         updateHorizontalScrollbarMaximum();
     }
 
@@ -194,6 +197,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setColumnAutoFit(std::size_t index, bool autoFit)
+    {
+        if (index >= m_columns.size())
+        {
+            TGUI_PRINT_WARNING("setColumnAutoFit called with invalid index.");
+            return;
+        }
+
+        Column& column = m_columns[index];
+        if (column.autoFit == autoFit)
+            return;
+
+        column.autoFit = autoFit;
+        if (autoFit)
+            remeasureAutoFitColumn(index);
+        else
+        {
+            column.contentWidths.clear();
+            if (column.designWidth)
+                column.width = column.designWidth;
+            else
+                column.width = calculateAutoColumnWidth(column.text);
+        }
+
+        updateAutoFitColumnWidths();
+        updateHorizontalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::getColumnAutoFit(std::size_t index) const
+    {
+        if (index < m_columns.size())
+            return m_columns[index].autoFit;
+        else
+        {
+            TGUI_PRINT_WARNING("getColumnAutoFit called with invalid index.");
+            return false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::removeAllColumns()
     {
         m_columns.clear();
@@ -283,11 +329,10 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
+        addAutoFitWidths(item);
+        updateAutoFitColumnWidths();
         updateVerticalScrollbarMaximum();
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        updateAutoScroll();
 
         return m_items.size()-1;
     }
@@ -303,11 +348,10 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
+        addAutoFitWidths(item);
+        updateAutoFitColumnWidths();
         updateVerticalScrollbarMaximum();
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        updateAutoScroll();
 
         return m_items.size()-1;
     }
@@ -324,13 +368,12 @@ namespace tgui
                 item.texts.push_back(createText(text));
 
             item.icon.setOpacity(m_opacityCached);
+            addAutoFitWidths(item);
         }
 
+        updateAutoFitColumnWidths();
         updateVerticalScrollbarMaximum();
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        updateAutoScroll();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,11 +384,14 @@ namespace tgui
             return false;
 
         Item& item = m_items[index];
+        removeAutoFitWidths(item);
         item.texts.clear();
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
             item.texts.push_back(createText(text));
 
+        addAutoFitWidths(item);
+        updateAutoFitColumnWidths();
         return true;
     }
 
@@ -358,9 +404,54 @@ namespace tgui
 
         Item& item = m_items[index];
         if (column >= item.texts.size())
-            item.texts.resize(column + 1);
+        {
+            // The columns in between get an empty text, which has to be measured as well
+            removeAutoFitWidths(item);
+            item.texts.reserve(column + 1);
+            while (item.texts.size() <= column)
+                item.texts.push_back(createText(""));
+
+            item.texts[column] = createText(itemText);
+            addAutoFitWidths(item);
+        }
+        else if ((column < m_columns.size()) && m_columns[column].autoFit)
+        {
+            auto& contentWidths = m_columns[column].contentWidths;
+            const auto it = contentWidths.find(item.textWidths[column]);
+            if (it != contentWidths.end())
+                contentWidths.erase(it);
 
-        item.texts[column] = createText(itemText);
+            item.texts[column] = createText(itemText);
+            item.textWidths[column] = calculateAutoColumnWidth(item.texts[column]);
+            contentWidths.insert(item.textWidths[column]);
+        }
+        else
+            item.texts[column] = createText(itemText);
+
+        updateAutoFitColumnWidths();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::changeItems(std::size_t startIndex, const std::vector<std::vector<sf::String>>& items)
+    {
+        if ((startIndex > m_items.size()) || (items.size() > m_items.size() - startIndex))
+            return false;
+
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+            Item& item = m_items[startIndex + i];
+            removeAutoFitWidths(item);
+            item.texts.clear();
+            item.texts.reserve(items[i].size());
+            for (const auto& text : items[i])
+                item.texts.push_back(createText(text));
+
+            addAutoFitWidths(item);
+        }
+
+        updateAutoFitColumnWidths();
         return true;
     }
 
@@ -393,29 +484,70 @@ namespace tgui
             return false;
 
         const bool wasIconSet = m_items[index].icon.isSet();
+        removeAutoFitWidths(m_items[index]);
+        removeCellStyles(index, 1);
         m_items.erase(m_items.begin() + index);
 
         if (wasIconSet)
         {
             --m_iconCount;
+            updateMaxIconWidth();
+        }
 
-            const float oldMaxIconWidth = m_maxIconWidth;
-            m_maxIconWidth = 0;
-            if (m_iconCount > 0)
-            {
-                // Rescan all items to find the largest icon
-                for (const auto& item : m_items)
-                {
-                    if (!item.icon.isSet())
-                        continue;
+        updateAutoFitColumnWidths();
+        updateVerticalScrollbarMaximum();
+        return true;
+    }
 
-                    m_maxIconWidth = std::max(m_maxIconWidth, item.icon.getSize().x);
-                    if (m_maxIconWidth == oldMaxIconWidth)
-                        break;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::removeItems(std::size_t startIndex, std::size_t count)
+    {
+        if ((startIndex > m_items.size()) || (count > m_items.size() - startIndex))
+            return false;
+        if (count == 0)
+            return true;
+
+        const int first = static_cast<int>(startIndex);
+        const int last = static_cast<int>(startIndex + count);
+
+        // Update the hovered item
+        if (m_hoveredItem >= first)
+        {
+            if (m_hoveredItem < last)
+                updateHoveredItem(-1);
+            else
+                m_hoveredItem -= static_cast<int>(count);
         }
 
+        // Update the selected item
+        if (m_selectedItem >= first)
+        {
+            if (m_selectedItem < last)
+                updateSelectedItem(-1);
+            else
+                m_selectedItem -= static_cast<int>(count);
+        }
+
+        unsigned int removedIconCount = 0;
+        for (std::size_t i = startIndex; i < startIndex + count; ++i)
+        {
+            if (m_items[i].icon.isSet())
+                ++removedIconCount;
+
+            removeAutoFitWidths(m_items[i]);
+        }
+
+        removeCellStyles(startIndex, count);
+        m_items.erase(m_items.begin() + startIndex, m_items.begin() + startIndex + count);
+
+        if (removedIconCount > 0)
+        {
+            m_iconCount -= removedIconCount;
+            updateMaxIconWidth();
+        }
+
+        updateAutoFitColumnWidths();
         updateVerticalScrollbarMaximum();
         return true;
     }
@@ -428,15 +560,49 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_cellStyles.clear();
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
 
+        for (auto& column : m_columns)
+            column.contentWidths.clear();
+
+        updateAutoFitColumnWidths();
         updateVerticalScrollbarMaximum();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::beginUpdate()
+    {
+        ++m_updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::endUpdate()
+    {
+        if (m_updateDepth == 0)
+        {
+            TGUI_PRINT_WARNING("endUpdate called without matching beginUpdate.");
+            return;
+        }
+
+        --m_updateDepth;
+        if (m_updateDepth == 0)
+            finishUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isUpdating() const
+    {
+        return m_updateDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
         if (index >= m_items.size())
@@ -490,23 +656,10 @@ namespace tgui
         else if (wasIconSet)
         {
             --m_iconCount;
-
-            const float oldMaxIconWidth = m_maxIconWidth;
-            m_maxIconWidth = 0;
-            if (m_iconCount > 0)
-            {
-                // Rescan all items to find the largest icon
-                for (const auto& item : m_items)
-                {
-                    if (!item.icon.isSet())
-                        continue;
-
-                    m_maxIconWidth = std::max(m_maxIconWidth, item.icon.getSize().x);
-                    if (m_maxIconWidth == oldMaxIconWidth)
-                        break;
-                }
-            }
+            updateMaxIconWidth();
         }
+
+        updateAutoFitColumnWidths();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -564,8 +717,7 @@ namespace tgui
         if (index >= m_items.size())
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
+        const auto itemCmp = [index, &cmp](const ListView::Item &a, const ListView::Item& b)
             {
                 sf::String s1;
                 if (index < a.texts.size())
@@ -576,7 +728,71 @@ namespace tgui
                     s2 = b.texts[index].getString();
 
                 return cmp(s1, s2);
-            });
+            };
+
+        if (m_cellStyles.empty())
+        {
+            std::sort(m_items.begin(), m_items.end(), itemCmp);
+            return;
+        }
+
+        // When cells have a style, we need to know where each item ends up so that the styles can be moved with them
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [this, &itemCmp](std::size_t a, std::size_t b){ return itemCmp(m_items[a], m_items[b]); });
+
+        std::vector<Item> sortedItems;
+        sortedItems.reserve(m_items.size());
+        std::vector<std::size_t> newIndices(m_items.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            sortedItems.push_back(std::move(m_items[order[i]]));
+            newIndices[order[i]] = i;
+        }
+        m_items = std::move(sortedItems);
+
+        std::map<std::pair<std::size_t, std::size_t>, CellStyle> sortedCellStyles;
+        for (const auto& pair : m_cellStyles)
+            sortedCellStyles.emplace(std::make_pair(newIndices[pair.first.first], pair.first.second), pair.second);
+        m_cellStyles = std::move(sortedCellStyles);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setCellStyle(std::size_t index, std::size_t column, const CellStyle& style)
+    {
+        if (index >= m_items.size())
+        {
+            TGUI_PRINT_WARNING("setCellStyle called with invalid index.");
+            return;
+        }
+
+        m_cellStyles[{index, column}] = style;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListView::CellStyle ListView::getCellStyle(std::size_t index, std::size_t column) const
+    {
+        const auto it = m_cellStyles.find({index, column});
+        if (it != m_cellStyles.end())
+            return it->second;
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeCellStyle(std::size_t index, std::size_t column)
+    {
+        m_cellStyles.erase({index, column});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeAllCellStyles()
+    {
+        m_cellStyles.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -629,6 +845,9 @@ namespace tgui
                 for (auto& text : item.texts)
                     text.setCharacterSize(m_textSize);
             }
+
+            remeasureAutoFitColumns();
+            updateAutoFitColumnWidths();
         }
 
         updateVerticalScrollbarMaximum();
@@ -662,6 +881,9 @@ namespace tgui
         for (Column& column : m_columns)
             column.text.setCharacterSize(headerTextSize);
 
+        remeasureAutoFitColumns();
+        updateAutoFitColumnWidths();
+
         m_horizontalScrollbar->setScrollAmount(m_textSize);
     }
 
@@ -687,6 +909,7 @@ namespace tgui
                 column.width = calculateAutoColumnWidth(column.text);
         }
 
+        updateAutoFitColumnWidths();
         updateHorizontalScrollbarMaximum();
     }
 
@@ -941,6 +1164,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
             }
         }
 
@@ -1096,14 +1320,15 @@ namespace tgui
 
     Signal& ListView::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else if (signalName == toLower(onRightClick.getName()))
-            return onRightClick;
-        else if (signalName == toLower(onHeaderClick.getName()))
-            return onHeaderClick;
+        static const internal_signal::SignalTable<ListView> signals{*this, {
+                [](ListView& listView) -> Signal& { return listView.onItemSelect; },
+                [](ListView& listView) -> Signal& { return listView.onDoubleClick; },
+                [](ListView& listView) -> Signal& { return listView.onRightClick; },
+                [](ListView& listView) -> Signal& { return listView.onHeaderClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -1250,12 +1475,14 @@ namespace tgui
                 }
             }
 
-            // Recalculate the width of the columns if they depended on the header text
+            // Recalculate the width of the columns if they depended on the header text or their contents
             for (auto& column : m_columns)
             {
                 if (column.designWidth == 0)
                     column.width = calculateAutoColumnWidth(column.text);
             }
+            remeasureAutoFitColumns();
+            updateAutoFitColumnWidths();
             updateHorizontalScrollbarMaximum();
         }
         else
@@ -1282,6 +1509,9 @@ namespace tgui
             else if (column.alignment == ColumnAlignment::Right)
                 columnNode->propertyValuePairs["Alignment"] = std::make_unique<DataIO::ValueNode>("Right");
 
+            if (column.autoFit)
+                columnNode->propertyValuePairs["AutoFit"] = std::make_unique<DataIO::ValueNode>("true");
+
             node->children.push_back(std::move(columnNode));
         }
 
@@ -1379,7 +1609,9 @@ namespace tgui
                     throw Exception{"Failed to parse Alignment property, found unknown value."};
             }
 
-            addColumn(text, width, alignment);
+            const std::size_t columnIndex = addColumn(text, width, alignment);
+            if (childNode->propertyValuePairs["autofit"])
+                setColumnAutoFit(columnIndex, Deserializer::deserialize(ObjectConverter::Type::Bool, childNode->propertyValuePairs["autofit"]->value).getBool());
         }
 
         for (const auto& childNode : node->children)
@@ -1510,6 +1742,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::addAutoFitWidths(Item& item)
+    {
+        item.textWidths.resize(item.texts.size());
+
+        const std::size_t columnCount = std::min(m_columns.size(), item.texts.size());
+        for (std::size_t i = 0; i < columnCount; ++i)
+        {
+            if (!m_columns[i].autoFit)
+                continue;
+
+            item.textWidths[i] = calculateAutoColumnWidth(item.texts[i]);
+            m_columns[i].contentWidths.insert(item.textWidths[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeAutoFitWidths(const Item& item)
+    {
+        const std::size_t columnCount = std::min(m_columns.size(), item.texts.size());
+        for (std::size_t i = 0; i < columnCount; ++i)
+        {
+            if (!m_columns[i].autoFit)
+                continue;
+
+            // The width is removed as it was stored, measuring the text again could give a slightly different value
+            auto& contentWidths = m_columns[i].contentWidths;
+            const auto it = contentWidths.find(item.textWidths[i]);
+            if (it != contentWidths.end())
+                contentWidths.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::remeasureAutoFitColumn(std::size_t column)
+    {
+        auto& contentWidths = m_columns[column].contentWidths;
+        contentWidths.clear();
+        for (auto& item : m_items)
+        {
+            if (column >= item.texts.size())
+                continue;
+
+            item.textWidths.resize(item.texts.size());
+            item.textWidths[column] = calculateAutoColumnWidth(item.texts[column]);
+            contentWidths.insert(item.textWidths[column]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::remeasureAutoFitColumns()
+    {
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            if (m_columns[i].autoFit)
+                remeasureAutoFitColumn(i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateAutoFitColumnWidths()
+    {
+        if (m_updateDepth > 0)
+        {
+            m_pendingAutoFitColumnWidthsUpdate = true;
+            return;
+        }
+
+        bool widthChanged = false;
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            Column& column = m_columns[i];
+            if (!column.autoFit)
+                continue;
+
+            float width = calculateAutoColumnWidth(column.text);
+            if (!column.contentWidths.empty())
+            {
+                float contentWidth = *column.contentWidths.rbegin();
+
+                // The texts in the first column are shifted to the right when there are icons
+                if ((i == 0) && (m_iconCount > 0))
+                    contentWidth += m_maxIconWidth + Text::getExtraHorizontalOffset(m_fontCached, m_textSize);
+
+                width = std::max(width, contentWidth);
+            }
+
+            if (column.width != width)
+            {
+                column.width = width;
+                widthChanged = true;
+            }
+        }
+
+        if (widthChanged)
+            updateHorizontalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::updateSelectedAndhoveredItemColors()
     {
         if (m_selectedItem >= 0)
@@ -1586,7 +1921,10 @@ namespace tgui
         }
 
         m_selectedItem = item;
-        onItemSelect.emit(this, m_selectedItem);
+        if (m_updateDepth > 0)
+            m_pendingItemSelectSignal = true;
+        else
+            onItemSelect.emit(this, m_selectedItem);
 
         updateSelectedAndhoveredItemColors();
     }
@@ -1693,6 +2031,12 @@ namespace tgui
 
     void ListView::updateVerticalScrollbarMaximum()
     {
+        if (m_updateDepth > 0)
+        {
+            m_pendingVerticalScrollbarUpdate = true;
+            return;
+        }
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
         unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
@@ -1711,6 +2055,12 @@ namespace tgui
 
     void ListView::updateHorizontalScrollbarMaximum()
     {
+        if (m_updateDepth > 0)
+        {
+            m_pendingHorizontalScrollbarUpdate = true;
+            return;
+        }
+
         if (!m_headerVisible || m_columns.empty())
             m_horizontalScrollbar->setMaximum(0u);
         else if (m_columns.size() == 1)
@@ -1734,6 +2084,127 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::updateAutoScroll()
+    {
+        if (!m_autoScroll)
+            return;
+
+        if (m_updateDepth > 0)
+        {
+            m_pendingAutoScroll = true;
+            return;
+        }
+
+        if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateMaxIconWidth()
+    {
+        if (m_updateDepth > 0)
+        {
+            m_pendingMaxIconWidthUpdate = true;
+            return;
+        }
+
+        const float oldMaxIconWidth = m_maxIconWidth;
+        m_maxIconWidth = 0;
+        if (m_iconCount > 0)
+        {
+            // Rescan all items to find the largest icon
+            for (const auto& item : m_items)
+            {
+                if (!item.icon.isSet())
+                    continue;
+
+                m_maxIconWidth = std::max(m_maxIconWidth, item.icon.getSize().x);
+                if (m_maxIconWidth == oldMaxIconWidth)
+                    break;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::finishUpdate()
+    {
+        if (m_pendingMaxIconWidthUpdate)
+        {
+            m_pendingMaxIconWidthUpdate = false;
+            updateMaxIconWidth();
+        }
+
+        if (m_pendingAutoFitColumnWidthsUpdate)
+        {
+            m_pendingAutoFitColumnWidthsUpdate = false;
+            updateAutoFitColumnWidths();
+        }
+
+        if (m_pendingHorizontalScrollbarUpdate)
+        {
+            m_pendingHorizontalScrollbarUpdate = false;
+            updateHorizontalScrollbarMaximum();
+        }
+
+        if (m_pendingVerticalScrollbarUpdate)
+        {
+            m_pendingVerticalScrollbarUpdate = false;
+            updateVerticalScrollbarMaximum();
+        }
+
+        if (m_pendingAutoScroll)
+        {
+            m_pendingAutoScroll = false;
+            updateAutoScroll();
+        }
+
+        if (m_pendingItemSelectSignal)
+        {
+            m_pendingItemSelectSignal = false;
+            onItemSelect.emit(this, m_selectedItem);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeCellStyles(std::size_t startIndex, std::size_t count)
+    {
+        if (m_cellStyles.empty())
+            return;
+
+        const auto firstRemoved = m_cellStyles.lower_bound({startIndex, 0});
+        const auto firstMoved = m_cellStyles.lower_bound({startIndex + count, 0});
+        if (firstMoved == m_cellStyles.end())
+        {
+            m_cellStyles.erase(firstRemoved, m_cellStyles.end());
+            return;
+        }
+
+        // The styles of the items below the removed ones have to be stored with their new index
+        std::vector<std::pair<std::pair<std::size_t, std::size_t>, CellStyle>> movedCellStyles(firstMoved, m_cellStyles.end());
+        m_cellStyles.erase(firstRemoved, m_cellStyles.end());
+        for (auto& pair : movedCellStyles)
+            m_cellStyles.emplace_hint(m_cellStyles.end(), std::make_pair(pair.first.first - count, pair.first.second), std::move(pair.second));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListView::CellStyle* ListView::getCellStyleForDrawing(std::size_t index, std::size_t column) const
+    {
+        if (m_cellStyles.empty() || (static_cast<int>(index) == m_selectedItem) || (static_cast<int>(index) == m_hoveredItem))
+            return nullptr;
+
+        const auto it = m_cellStyles.find({index, column});
+        if (it != m_cellStyles.end())
+            return &it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::drawHeaderText(sf::RenderTarget& target, sf::RenderStates states, float columnWidth, float headerHeight, std::size_t column) const
     {
         if (column >= m_columns.size())
@@ -1769,6 +2240,22 @@ namespace tgui
         const float columnHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()
                                    - getCurrentHeaderHeight() - (m_horizontalScrollbar->isShown() ? m_horizontalScrollbar->getSize().y : 0);
 
+        // Draw the backgrounds of cells that have their own background color
+        if (!m_cellStyles.empty())
+        {
+            const Clipping clipping{target, states, {}, {columnWidth, columnHeight}};
+            for (std::size_t i = firstItem; i < lastItem; ++i)
+            {
+                const CellStyle* cellStyle = getCellStyleForDrawing(i, column);
+                if (!cellStyle || !cellStyle->backgroundColor.isSet())
+                    continue;
+
+                sf::RenderStates cellStates = states;
+                cellStates.transform.translate({0, (requiredItemHeight * i) - static_cast<float>(m_verticalScrollbar->getValue())});
+                drawRectangleShape(target, cellStates, {columnWidth, static_cast<float>(m_itemHeight)}, cellStyle->backgroundColor);
+            }
+        }
+
         // Draw the icons.
         // If at least one icon is set then all items in the first column have to be shifted to make room for the icon.
         if ((column == 0) && (m_iconCount > 0))
@@ -1802,6 +2289,14 @@ namespace tgui
 
         const Clipping clipping{target, states, {textPadding, 0}, {columnWidth - (2 * textPadding), columnHeight}};
 
+        // Cells with their own text color or style are drawn with a single text object to which the style of the cell is applied
+        if (!m_cellStyles.empty())
+        {
+            m_styledCellText.setFont(m_fontCached);
+            m_styledCellText.setCharacterSize(m_textSize);
+            m_styledCellText.setOpacity(m_opacityCached);
+        }
+
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
@@ -1811,16 +2306,26 @@ namespace tgui
                 continue;
             }
 
+            const Text* text = &m_items[i].texts[column];
+            const CellStyle* cellStyle = getCellStyleForDrawing(i, column);
+            if (cellStyle && (cellStyle->textColor.isSet() || cellStyle->textStyle.isSet()))
+            {
+                m_styledCellText.setColor(cellStyle->textColor.isSet() ? cellStyle->textColor : text->getColor());
+                m_styledCellText.setStyle(cellStyle->textStyle.isSet() ? cellStyle->textStyle : text->getStyle());
+                m_styledCellText.setString(text->getString());
+                text = &m_styledCellText;
+            }
+
             float translateX;
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - text->getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - text->getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            m_items[i].texts[column].draw(target, states);
+            text->draw(target, states);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
     }
@@ -1836,6 +2341,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
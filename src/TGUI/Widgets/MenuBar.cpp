@@ -770,8 +770,12 @@ namespace tgui
 
     Signal& MenuBar::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMenuItemClick.getName()))
-            return onMenuItemClick;
+        static const internal_signal::SignalTable<MenuBar> signals{*this, {
+                [](MenuBar& menuBar) -> Signal& { return menuBar.onMenuItemClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
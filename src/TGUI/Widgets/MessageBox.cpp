@@ -295,8 +295,12 @@ namespace tgui
 
     Signal& MessageBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onButtonPress.getName()))
-            return onButtonPress;
+        static const internal_signal::SignalTable<MessageBox> signals{*this, {
+                [](MessageBox& messageBox) -> Signal& { return messageBox.onButtonPress; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ChildWindow::getSignal(std::move(signalName));
     }
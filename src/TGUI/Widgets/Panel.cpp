@@ -184,18 +184,17 @@ namespace tgui
 
     Signal& Panel::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
-        else if (signalName == toLower(onRightMousePress.getName()))
-            return onRightMousePress;
-        else if (signalName == toLower(onRightMouseRelease.getName()))
-            return onRightMouseRelease;
-        else if (signalName == toLower(onRightClick.getName()))
-            return onRightClick;
+        static const internal_signal::SignalTable<Panel> signals{*this, {
+                [](Panel& panel) -> Signal& { return panel.onMousePress; },
+                [](Panel& panel) -> Signal& { return panel.onMouseRelease; },
+                [](Panel& panel) -> Signal& { return panel.onClick; },
+                [](Panel& panel) -> Signal& { return panel.onRightMousePress; },
+                [](Panel& panel) -> Signal& { return panel.onRightMouseRelease; },
+                [](Panel& panel) -> Signal& { return panel.onRightClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Group::getSignal(std::move(signalName));
     }
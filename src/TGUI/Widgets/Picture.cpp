@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
             }
         }
     }
@@ -167,8 +168,12 @@ namespace tgui
 
     Signal& Picture::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const internal_signal::SignalTable<Picture> signals{*this, {
+                [](Picture& picture) -> Signal& { return picture.onDoubleClick; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
@@ -228,6 +233,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
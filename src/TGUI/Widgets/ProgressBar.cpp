@@ -291,10 +291,13 @@ namespace tgui
 
     Signal& ProgressBar::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
-        else if (signalName == toLower(onFull.getName()))
-            return onFull;
+        static const internal_signal::SignalTable<ProgressBar> signals{*this, {
+                [](ProgressBar& progressBar) -> Signal& { return progressBar.onValueChange; },
+                [](ProgressBar& progressBar) -> Signal& { return progressBar.onFull; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
@@ -277,12 +277,14 @@ namespace tgui
 
     Signal& RadioButton::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onCheck.getName()))
-            return onCheck;
-        else if (signalName == toLower(onUncheck.getName()))
-            return onUncheck;
-        else if (signalName == toLower(onChange.getName()))
-            return onChange;
+        static const internal_signal::SignalTable<RadioButton> signals{*this, {
+                [](RadioButton& radioButton) -> Signal& { return radioButton.onCheck; },
+                [](RadioButton& radioButton) -> Signal& { return radioButton.onUncheck; },
+                [](RadioButton& radioButton) -> Signal& { return radioButton.onChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
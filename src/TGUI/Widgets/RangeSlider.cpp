@@ -485,8 +485,12 @@ namespace tgui
 
     Signal& RangeSlider::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onRangeChange.getName()))
-            return onRangeChange;
+        static const internal_signal::SignalTable<RangeSlider> signals{*this, {
+                [](RangeSlider& rangeSlider) -> Signal& { return rangeSlider.onRangeChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -210,15 +210,11 @@ namespace tgui
 
         if (m_contentSize == Vector2f{0, 0})
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if (bottomRight.x > m_mostBottomRightPosition.x)
-                m_mostBottomRightPosition.x = bottomRight.x;
-            if (bottomRight.y > m_mostBottomRightPosition.y)
-                m_mostBottomRightPosition.y = bottomRight.y;
-
-            updateScrollbars();
-
             connectPositionAndSize(widget);
+
+            // The content size no longer depends on the panel size once the first widget is added
+            if (recalculateMostBottomRightPosition() || (m_widgets.size() == 1))
+                updateScrollbars();
         }
     }
 
@@ -232,18 +228,15 @@ namespace tgui
             widget->disconnect(callbackIt->second-1);
             widget->disconnect(callbackIt->second);
             m_connectedCallbacks.erase(callbackIt);
+            eraseChildBounds(widget.get());
         }
 
         const bool ret = Panel::remove(widget);
 
         if (m_contentSize == Vector2f{0, 0})
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if ((bottomRight.x == m_mostBottomRightPosition.x) || (bottomRight.y == m_mostBottomRightPosition.y))
-            {
-                recalculateMostBottomRightPosition();
+            if (recalculateMostBottomRightPosition() || m_widgets.empty())
                 updateScrollbars();
-            }
         }
 
         return ret;
@@ -274,11 +267,11 @@ namespace tgui
 
         if (m_contentSize == Vector2f{0, 0})
         {
-            recalculateMostBottomRightPosition();
-
             // Automatically recalculate the bottom right position when the position or size of a widget changes
             for (auto& widget : m_widgets)
                 connectPositionAndSize(widget);
+
+            recalculateMostBottomRightPosition();
         }
 
         updateScrollbars();
@@ -792,25 +785,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::recalculateMostBottomRightPosition()
+    bool ScrollablePanel::recalculateMostBottomRightPosition()
     {
+        const Vector2f oldPosition = m_mostBottomRightPosition;
+
+        // The largest edges are found at the end of the sorted sets, the content never starts left or above the panel
         m_mostBottomRightPosition = {0, 0};
+        if (!m_childRightEdges.empty() && (*m_childRightEdges.rbegin() > 0))
+            m_mostBottomRightPosition.x = *m_childRightEdges.rbegin();
+        if (!m_childBottomEdges.empty() && (*m_childBottomEdges.rbegin() > 0))
+            m_mostBottomRightPosition.y = *m_childBottomEdges.rbegin();
 
-        for (const auto& widget : m_widgets)
-        {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if (bottomRight.x > m_mostBottomRightPosition.x)
-                m_mostBottomRightPosition.x = bottomRight.x;
-            if (bottomRight.y > m_mostBottomRightPosition.y)
-                m_mostBottomRightPosition.y = bottomRight.y;
-        }
+        return m_mostBottomRightPosition != oldPosition;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::insertChildBounds(const Widget* widget)
+    {
+        const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
+        m_childBottomRights[widget] = bottomRight;
+        m_childRightEdges.insert(bottomRight.x);
+        m_childBottomEdges.insert(bottomRight.y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::eraseChildBounds(const Widget* widget)
+    {
+        const auto it = m_childBottomRights.find(widget);
+        if (it == m_childBottomRights.end())
+            return;
+
+        // Only a single copy of the values may be removed, other widgets can share the same edge
+        m_childRightEdges.erase(m_childRightEdges.find(it->second.x));
+        m_childBottomEdges.erase(m_childBottomEdges.find(it->second.y));
+        m_childBottomRights.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::childBoundsChanged(const Widget* widget)
+    {
+        eraseChildBounds(widget);
+        insertChildBounds(widget);
+
+        if (recalculateMostBottomRightPosition())
+            updateScrollbars();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::connectPositionAndSize(Widget::Ptr widget)
     {
-        m_connectedCallbacks[widget] = widget->connect({"PositionChanged", "SizeChanged"}, [this](){ recalculateMostBottomRightPosition(); updateScrollbars(); });
+        const Widget* widgetPtr = widget.get();
+        m_connectedCallbacks[widget] = widget->connect({"PositionChanged", "SizeChanged"}, [this,widgetPtr](){ childBoundsChanged(widgetPtr); });
+        insertChildBounds(widgetPtr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -824,6 +854,9 @@ namespace tgui
         }
 
         m_connectedCallbacks.clear();
+        m_childBottomRights.clear();
+        m_childRightEdges.clear();
+        m_childBottomEdges.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -774,8 +774,12 @@ namespace tgui
 
     Signal& Scrollbar::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const internal_signal::SignalTable<Scrollbar> signals{*this, {
+                [](Scrollbar& scrollbar) -> Signal& { return scrollbar.onValueChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -493,8 +493,12 @@ namespace tgui
 
     Signal& Slider::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const internal_signal::SignalTable<Slider> signals{*this, {
+                [](Slider& slider) -> Signal& { return slider.onValueChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
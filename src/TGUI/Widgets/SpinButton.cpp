@@ -327,8 +327,12 @@ namespace tgui
 
     Signal& SpinButton::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const internal_signal::SignalTable<SpinButton> signals{*this, {
+                [](SpinButton& spinButton) -> Signal& { return spinButton.onValueChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
@@ -551,8 +551,12 @@ namespace tgui
 
     Signal& Tabs::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onTabSelect.getName()))
-            return onTabSelect;
+        static const internal_signal::SignalTable<Tabs> signals{*this, {
+                [](Tabs& tabs) -> Signal& { return tabs.onTabSelect; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -400,6 +400,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            scheduleUpdate(sf::milliseconds(500));
         }
         else // Unfocusing
         {
@@ -553,6 +554,7 @@ namespace tgui
             // The caret should be visible
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            scheduleUpdate(sf::milliseconds(500));
         }
     }
 
@@ -977,6 +979,7 @@ namespace tgui
                 // The caret should be visible again
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
+                scheduleUpdate(sf::milliseconds(500));
 
                 onTextChange.emit(this, m_text);
                 break;
@@ -1074,6 +1077,7 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        scheduleUpdate(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1135,6 +1139,7 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        scheduleUpdate(sf::milliseconds(500));
 
         onTextChange.emit(this, m_text);
     }
@@ -1613,6 +1618,10 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        // Keep blinking the caret while focused
+        if (m_focused || m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1747,10 +1756,13 @@ namespace tgui
 
     Signal& TextBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
-        else if (signalName == toLower(onSelectionChange.getName()))
-            return onSelectionChange;
+        static const internal_signal::SignalTable<TextBox> signals{*this, {
+                [](TextBox& textBox) -> Signal& { return textBox.onTextChange; },
+                [](TextBox& textBox) -> Signal& { return textBox.onSelectionChange; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -759,6 +759,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdate(sf::milliseconds(getDoubleClickTime()));
                 m_doubleClickNodeIndex = selectedIndex;
             }
         }
@@ -855,14 +856,15 @@ namespace tgui
 
     Signal& TreeView::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else if (signalName == toLower(onExpand.getName()))
-            return onExpand;
-        else if (signalName == toLower(onCollapse.getName()))
-            return onCollapse;
+        static const internal_signal::SignalTable<TreeView> signals{*this, {
+                [](TreeView& treeView) -> Signal& { return treeView.onItemSelect; },
+                [](TreeView& treeView) -> Signal& { return treeView.onDoubleClick; },
+                [](TreeView& treeView) -> Signal& { return treeView.onExpand; },
+                [](TreeView& treeView) -> Signal& { return treeView.onCollapse; }
+            }};
+
+        if (Signal* signal = signals.find(*this, signalName))
+            return *signal;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -1026,6 +1028,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick)
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
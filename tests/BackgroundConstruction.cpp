@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/BackgroundConstruction.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <thread>
+
+TEST_CASE("[BackgroundConstruction]")
+{
+    SECTION("Active object")
+    {
+        REQUIRE(tgui::BackgroundConstruction::getActive() == nullptr);
+
+        {
+            tgui::BackgroundConstruction construction;
+            REQUIRE(tgui::BackgroundConstruction::getActive() == &construction);
+            REQUIRE_THROWS_AS(tgui::BackgroundConstruction{}, tgui::Exception);
+
+            // The object only affects the thread on which it was created
+            tgui::BackgroundConstruction* activeOnOtherThread = &construction;
+            std::thread([&]{ activeOnOtherThread = tgui::BackgroundConstruction::getActive(); }).join();
+            REQUIRE(activeOnOtherThread == nullptr);
+        }
+
+        REQUIRE(tgui::BackgroundConstruction::getActive() == nullptr);
+    }
+
+    SECTION("Theme and font")
+    {
+        tgui::Theme* defaultTheme = tgui::Theme::getDefault();
+        const tgui::Font globalFont = tgui::getGlobalFont();
+
+        {
+            tgui::BackgroundConstruction construction;
+            REQUIRE(construction.getTheme() == nullptr);
+            REQUIRE(construction.getFont() == nullptr);
+
+            // Widgets get their own renderers and font, so that nothing is shared with widgets of the gui thread
+            auto button = tgui::Button::create();
+            REQUIRE(construction.getTheme() != nullptr);
+            REQUIRE(construction.getFont() != nullptr);
+            REQUIRE(tgui::Theme::getDefault() == construction.getTheme().get());
+            REQUIRE(tgui::Theme::getDefault() != defaultTheme);
+            REQUIRE(tgui::getGlobalFont() == construction.getFont());
+            REQUIRE(tgui::getGlobalFont() != globalFont);
+            REQUIRE(button->getSharedRenderer()->getData() == construction.getTheme()->getRenderer("Button"));
+            REQUIRE(button->getSharedRenderer()->getData() != defaultTheme->getRenderer("Button"));
+            REQUIRE(button->getSharedRenderer()->getBorders() == tgui::Borders{1});
+
+            auto theme = std::make_shared<tgui::Theme>();
+            construction.setTheme(theme);
+            REQUIRE(tgui::Theme::getDefault() == theme.get());
+
+            tgui::Font font{"resources/DejaVuSans.ttf"};
+            construction.setFont(font);
+            REQUIRE(tgui::getGlobalFont() == font);
+        }
+
+        REQUIRE(tgui::Theme::getDefault() == defaultTheme);
+        REQUIRE(tgui::getGlobalFont() == globalFont);
+    }
+
+    SECTION("Textures")
+    {
+        tgui::Texture texture;
+        tgui::Texture partialTexture;
+
+        {
+            tgui::BackgroundConstruction construction;
+            texture = tgui::Texture{"resources/image.png", {10, 5, 20, 25}};
+            partialTexture = tgui::Texture{"resources/image.png", {40, 0, 20, 60}};
+
+            // The images are loaded, but the textures aren't created yet
+            REQUIRE(texture.getData()->uploadPending);
+            REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u{0, 0});
+            REQUIRE(texture.getImageSize() == tgui::Vector2f{20, 25});
+            REQUIRE(texture.getMiddleRect() == sf::IntRect{0, 0, 20, 25});
+            REQUIRE(partialTexture.getData()->uploadPending);
+            REQUIRE(partialTexture.getImageSize() == tgui::Vector2f{10, 50});
+        }
+
+        tgui::TextureManager::uploadPendingTexture(texture.getData());
+        REQUIRE(!texture.getData()->uploadPending);
+        REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u{20, 25});
+        REQUIRE(texture.getImageSize() == tgui::Vector2f{20, 25});
+
+        // Loading the same image outside the background construction creates the texture immediately
+        tgui::Texture otherTexture{"resources/image.png", {40, 0, 20, 60}};
+        REQUIRE(otherTexture.getData() == partialTexture.getData());
+        REQUIRE(!partialTexture.getData()->uploadPending);
+        REQUIRE(partialTexture.getData()->texture.getSize() == sf::Vector2u{10, 50});
+    }
+
+    SECTION("Attach")
+    {
+        tgui::Gui gui;
+
+        SECTION("Programmatically")
+        {
+            bool attachingChildFailed = false;
+            std::thread worker([&]{
+                    tgui::BackgroundConstruction construction;
+
+                    auto panel = tgui::Panel::create({200, 100});
+                    panel->add(tgui::Picture::create("resources/image.png"), "Picture");
+                    panel->add(tgui::Button::create("Button"), "Button");
+
+                    // Only widgets without a parent can be attached
+                    try
+                    {
+                        construction.attach(gui, panel->get("Button"));
+                    }
+                    catch (const tgui::Exception&)
+                    {
+                        attachingChildFailed = true;
+                    }
+
+                    construction.attach(gui, panel, "Panel");
+                });
+            worker.join();
+            REQUIRE(attachingChildFailed);
+
+            // The widget is only added when the gui thread executes the posted task
+            REQUIRE(gui.get("Panel") == nullptr);
+            REQUIRE(gui.processPostedTasks() == 1);
+
+            auto panel = gui.get<tgui::Panel>("Panel");
+            REQUIRE(panel != nullptr);
+            REQUIRE(panel->getWidgets().size() == 2);
+
+            auto picture = panel->get<tgui::Picture>("Picture");
+            REQUIRE(picture->getSize() == tgui::Vector2f{50, 50});
+            REQUIRE(!picture->getRenderer()->getTexture().getData()->uploadPending);
+            REQUIRE(picture->getRenderer()->getTexture().getData()->texture.getSize() == sf::Vector2u{50, 50});
+
+            // The attached widgets were given to the update scheduler of the gui
+            REQUIRE(gui.getContainer()->updateScheduledWidgets({}) >= 3);
+        }
+
+        SECTION("Multiple times")
+        {
+            tgui::Font firstFont;
+            tgui::Font secondFont;
+            std::shared_ptr<tgui::Theme> firstTheme;
+            std::shared_ptr<tgui::Theme> secondTheme;
+            bool handedOver = false;
+            std::thread worker([&]{
+                    tgui::BackgroundConstruction construction;
+
+                    tgui::Button::Ptr button = tgui::Button::create("First");
+                    firstFont = construction.getFont();
+                    firstTheme = construction.getTheme();
+                    construction.attach(gui, button, "First");
+
+                    // The theme and font were handed over to the gui thread, the next widgets get new ones
+                    handedOver = (construction.getFont() == nullptr) && (construction.getTheme() == nullptr);
+
+                    button = tgui::Button::create("Second");
+                    secondFont = construction.getFont();
+                    secondTheme = construction.getTheme();
+                    construction.attach(gui, button, "Second");
+                });
+            worker.join();
+
+            REQUIRE(handedOver);
+            REQUIRE(firstFont != nullptr);
+            REQUIRE(secondFont != nullptr);
+            REQUIRE(firstFont != secondFont);
+            REQUIRE(firstTheme != nullptr);
+            REQUIRE(secondTheme != nullptr);
+            REQUIRE(firstTheme != secondTheme);
+
+            REQUIRE(gui.processPostedTasks() == 2);
+            REQUIRE(gui.get<tgui::Button>("First")->getText() == "First");
+            REQUIRE(gui.get<tgui::Button>("Second")->getText() == "Second");
+        }
+
+        SECTION("Loaded from file")
+        {
+            auto form = tgui::Panel::create();
+            form->add(tgui::Button::create("Ok"), "OkButton");
+            form->add(tgui::Picture::create("resources/image.png"), "Image");
+            form->saveWidgetsToFile("BackgroundConstructionForm.txt");
+
+            auto parent = tgui::Group::create();
+            gui.add(parent);
+
+            std::thread worker([&gui,parent]{
+                    tgui::BackgroundConstruction construction;
+
+                    auto panel = tgui::Panel::create();
+                    panel->loadWidgetsFromFile("BackgroundConstructionForm.txt");
+                    construction.attach(gui, parent, panel, "Form");
+                });
+            worker.join();
+
+            REQUIRE(gui.processPostedTasks() == 1);
+            REQUIRE(parent->get("Form") != nullptr);
+            REQUIRE(parent->get<tgui::Button>("OkButton")->getText() == "Ok");
+            REQUIRE(parent->get<tgui::Picture>("Image")->getSize() == tgui::Vector2f{50, 50});
+        }
+    }
+}
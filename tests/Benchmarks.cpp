@@ -0,0 +1,346 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include "EventRecording.hpp"
+#include <TGUI/Widgets/VerticalLayout.hpp>
+#include <TGUI/Widgets/HorizontalWrap.hpp>
+#include <TGUI/Widgets/Grid.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ListView.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <iostream>
+#include <thread>
+
+// The benchmarks are hidden and only run when requested explicitly, e.g. with "tests [benchmark]"
+TEST_CASE("[Benchmarks]", "[.][benchmark]")
+{
+    SECTION("VerticalLayout")
+    {
+        std::vector<tgui::Widget::Ptr> buttons;
+        for (unsigned int i = 0; i < 10000; ++i)
+            buttons.push_back(tgui::Button::create());
+
+        auto layout = tgui::VerticalLayout::create({800, 600});
+
+        BENCHMARK("Adding 10000 buttons with addMultiple")
+        {
+            layout->removeAllWidgets();
+            layout->addMultiple(buttons);
+        }
+
+        REQUIRE(layout->getWidgets().size() == 10000);
+
+        // Adding the widgets one by one repositions all earlier widgets each time, so fewer widgets are used here
+        const std::vector<tgui::Widget::Ptr> fewerButtons(buttons.begin(), buttons.begin() + 2000);
+        BENCHMARK("Adding 2000 buttons one by one")
+        {
+            layout->removeAllWidgets();
+            for (const auto& button : fewerButtons)
+                layout->add(button);
+        }
+
+        BENCHMARK("Adding 2000 buttons with addMultiple")
+        {
+            layout->removeAllWidgets();
+            layout->addMultiple(fewerButtons);
+        }
+
+        REQUIRE(layout->getWidgets().size() == 2000);
+    }
+
+    SECTION("HorizontalWrap")
+    {
+        std::vector<tgui::Widget::Ptr> chips;
+        for (unsigned int i = 0; i < 5000; ++i)
+        {
+            auto chip = tgui::Button::create();
+            chip->setSize({40.f + (i % 7) * 10.f, 20});
+            chips.push_back(chip);
+        }
+
+        auto wrap = tgui::HorizontalWrap::create({800, 600});
+
+        BENCHMARK("Adding 5000 chips one by one")
+        {
+            wrap->removeAllWidgets();
+            for (const auto& chip : chips)
+                wrap->add(chip);
+        }
+
+        REQUIRE(wrap->getWidgets().size() == 5000);
+
+        BENCHMARK("Inserting a chip in the last line")
+        {
+            wrap->insert(4990, tgui::Button::create());
+            wrap->remove(4990);
+        }
+
+        BENCHMARK("Resizing the wrap without changing the lines")
+        {
+            wrap->setSize({801, 600});
+            wrap->setSize({800, 600});
+        }
+    }
+
+    SECTION("Grid")
+    {
+        auto grid = tgui::Grid::create();
+        grid->beginUpdate();
+        for (std::size_t row = 0; row < 200; ++row)
+        {
+            for (std::size_t col = 0; col < 50; ++col)
+                grid->addWidget(tgui::Button::create(), row, col);
+        }
+        grid->endUpdate();
+
+        auto cell = grid->getWidget(100, 25);
+        const sf::Vector2f originalSize = cell->getSize();
+
+        BENCHMARK("Resizing a widget in a 200x50 grid")
+        {
+            cell->setSize(originalSize + sf::Vector2f{5, 5});
+            cell->setSize(originalSize);
+        }
+
+        tgui::Padding padding{1};
+        BENCHMARK("Looking up the location of a widget in a 200x50 grid")
+        {
+            padding = grid->getWidgetPadding(cell);
+        }
+
+        REQUIRE(padding == tgui::Padding{0});
+    }
+
+    SECTION("Signals")
+    {
+        auto button = tgui::Button::create();
+
+        // The Widget signals are found last, after the signals of Button and ClickableWidget have been checked
+        BENCHMARK("Connecting and disconnecting 1000 signals by name")
+        {
+            for (unsigned int i = 0; i < 1000; ++i)
+            {
+                button->connect("Pressed", []{});
+                button->connect("MouseEntered", []{});
+            }
+
+            button->disconnectAll();
+        }
+    }
+
+    SECTION("Scheduled updates")
+    {
+        tgui::Gui gui;
+        auto panel = tgui::Panel::create();
+        gui.add(panel);
+        for (unsigned int i = 0; i < 10000; ++i)
+            panel->add(tgui::Button::create());
+
+        auto editBox = tgui::EditBox::create();
+        gui.add(editBox);
+        editBox->setFocused(true);
+
+        // Only the edit box has to be updated, the time it takes should not depend on the amount of buttons
+        BENCHMARK("Updating the time of a gui with 10000 widgets")
+        {
+            for (unsigned int i = 0; i < 100; ++i)
+                gui.updateTime(sf::milliseconds(16));
+        }
+    }
+
+    SECTION("Hover cache")
+    {
+        sf::RenderTexture target;
+        target.create(800, 600);
+        tgui::Gui gui{target};
+
+        // ChildWindow -> ScrollablePanel -> Grid -> Button, with the mouse moving inside a button in the last window
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            auto grid = tgui::Grid::create();
+            for (std::size_t row = 0; row < 20; ++row)
+            {
+                for (std::size_t col = 0; col < 10; ++col)
+                {
+                    auto button = tgui::Button::create();
+                    button->setSize(50, 30);
+                    grid->addWidget(button, row, col);
+                }
+            }
+
+            auto panel = tgui::ScrollablePanel::create({"100%", "100%"});
+            panel->add(grid);
+
+            auto window = tgui::ChildWindow::create();
+            window->setPosition(i * 5.f, i * 5.f);
+            window->setSize(600, 400);
+            window->add(panel);
+            gui.add(window);
+        }
+
+        const auto lastWindow = std::static_pointer_cast<tgui::ChildWindow>(gui.getWidgets().back());
+        const tgui::Vector2f buttonPos = lastWindow->getPosition() + lastWindow->getChildWidgetsOffset() + tgui::Vector2f{10, 10};
+
+        const auto moveMouse = [&]{
+                for (int i = 0; i < 1000; ++i)
+                {
+                    sf::Event event;
+                    event.type = sf::Event::MouseMoved;
+                    event.mouseMove.x = static_cast<int>(buttonPos.x) + (i % 10);
+                    event.mouseMove.y = static_cast<int>(buttonPos.y) + (i % 10);
+                    gui.handleEvent(event);
+                }
+            };
+
+        BENCHMARK("Moving the mouse 1000 times inside a deeply nested button")
+        {
+            moveMouse();
+        }
+
+        tgui::Container::setHoverCacheEnabled(true);
+        BENCHMARK("Moving the mouse 1000 times inside a deeply nested button with the hover cache")
+        {
+            moveMouse();
+        }
+        tgui::Container::setHoverCacheEnabled(false);
+    }
+
+    SECTION("Resource caches")
+    {
+        // Each thread acts like a separate gui that loads its widgets from the same theme and images
+        const auto loadResources = []{
+            tgui::Theme theme{"resources/Black.txt"};
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                for (int j = 1; j <= 8; ++j)
+                {
+                    tgui::Texture texture{"resources/Texture" + tgui::to_string(j) + ".png", {0, 0, 25 + 5*j, 25}};
+                    texture = tgui::Texture{"resources/Texture" + tgui::to_string(j) + ".png"};
+                }
+
+                theme.getRenderer("Button");
+                theme.getRenderer("EditBox");
+                theme.getRenderer("ListView");
+
+                tgui::WidgetFactory::getConstructFunction("Button");
+                tgui::WidgetFactory::getConstructFunction("Panel");
+            }
+        };
+
+        const auto runThreads = [&](unsigned int threadCount){
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < threadCount; ++i)
+                threads.emplace_back(loadResources);
+            for (auto& thread : threads)
+                thread.join();
+        };
+
+        BENCHMARK("Loading resources on 1 thread")
+        {
+            runThreads(1);
+        }
+
+        // Should take about the same time as on a single thread when there are enough cores
+        BENCHMARK("Loading resources on 8 threads")
+        {
+            runThreads(8);
+        }
+    }
+
+    // The recordings in resources/recordings describe the widgets on which they were recorded
+    SECTION("Replaying events")
+    {
+        sf::RenderTexture target;
+        target.create(800, 600);
+        tgui::Gui gui{target};
+
+        const auto replay = [&](const std::string& filename){
+                const EventRecording recording = EventRecording::load("resources/recordings/" + filename);
+
+                ReplayResult result;
+                BENCHMARK("Replaying " + filename)
+                {
+                    result = replayEvents(gui, target, recording);
+                }
+
+                std::cout << filename << ": " << result.eventDurations.size() << " events"
+                          << ", p50 " << result.getPercentile(50).asMicroseconds() << "us"
+                          << ", p90 " << result.getPercentile(90).asMicroseconds() << "us"
+                          << ", p99 " << result.getPercentile(99).asMicroseconds() << "us"
+                          << ", max " << result.getPercentile(100).asMicroseconds() << "us" << std::endl;
+            };
+
+        SECTION("ListView")
+        {
+            auto listView = tgui::ListView::create();
+            listView->setSize(600, 500);
+            listView->addColumn("Name", 200);
+            listView->addColumn("Value", 200);
+            listView->addColumn("Description", 200);
+            for (unsigned int i = 0; i < 2000; ++i)
+                listView->addItem({"Item " + tgui::to_string(i), tgui::to_string(i * 7), "Description of item " + tgui::to_string(i)});
+
+            gui.add(listView);
+            replay("ListViewHover.txt");
+        }
+
+        SECTION("ScrollablePanel")
+        {
+            auto panel = tgui::ScrollablePanel::create({400, 500});
+            for (unsigned int i = 0; i < 1000; ++i)
+            {
+                auto button = tgui::Button::create("Button " + tgui::to_string(i));
+                button->setPosition(0, i * 35.f);
+                button->setSize(380, 30);
+                panel->add(button);
+            }
+
+            gui.add(panel);
+            replay("ScrollablePanelDrag.txt");
+        }
+
+        SECTION("EditBox and TextBox")
+        {
+            auto editBox = tgui::EditBox::create();
+            editBox->setPosition(10, 10);
+            editBox->setSize(300, 30);
+            gui.add(editBox);
+
+            auto textBox = tgui::TextBox::create();
+            textBox->setPosition(10, 60);
+            textBox->setSize(400, 300);
+            gui.add(textBox);
+
+            replay("EditBoxTyping.txt");
+        }
+    }
+}
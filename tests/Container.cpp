@@ -130,6 +130,40 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("changing the tree")
+        {
+            // Renaming a widget
+            REQUIRE(container->setWidgetName(widget1, "renamed"));
+            REQUIRE(container->get("w1") == nullptr);
+            REQUIRE(container->get("renamed") == widget1);
+            REQUIRE(widget2->setWidgetName(widget4, "renamed"));
+            REQUIRE(container->get("renamed") == widget1);
+            REQUIRE(widget2->get("renamed") == widget4);
+
+            // Widgets added to a container that is already inside the tree
+            auto child = tgui::Panel::create();
+            auto grandChild = tgui::Label::create();
+            child->add(grandChild, "grandChild");
+            widget2->add(child, "child");
+            REQUIRE(container->get("child") == child);
+            REQUIRE(container->get("grandChild") == grandChild);
+
+            // Removing a container removes the names of the widgets inside it
+            widget2->remove(child);
+            REQUIRE(container->get("child") == nullptr);
+            REQUIRE(container->get("grandChild") == nullptr);
+            REQUIRE(child->get("grandChild") == grandChild);
+
+            container->add(child);
+            REQUIRE(container->get("grandChild") == grandChild);
+            child->removeAllWidgets();
+            REQUIRE(container->get("grandChild") == nullptr);
+
+            widget2->removeAllWidgets();
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("renamed") == widget1);
+        }
     }
 
     SECTION("remove")
@@ -265,6 +299,155 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("spatial index")
+    {
+        auto group = tgui::Group::create({400, 300});
+        REQUIRE(!group->isSpatialIndexEnabled());
+        REQUIRE(group->getSpatialIndexCellSize() == 64);
+
+        group->setSpatialIndexEnabled(true);
+        REQUIRE(group->isSpatialIndexEnabled());
+
+        group->setSpatialIndexCellSize(50);
+        REQUIRE(group->getSpatialIndexCellSize() == 50);
+        REQUIRE_THROWS_AS(group->setSpatialIndexCellSize(0), tgui::Exception);
+
+        std::string hovered;
+        auto addWidget = [&](const std::string& name, tgui::Vector2f pos, tgui::Vector2f size){
+                auto widget = tgui::ClickableWidget::create(size);
+                widget->setPosition(pos);
+                widget->connect("MouseEntered", [&hovered,name]{ hovered = name; });
+                widget->connect("MouseLeft", [&hovered]{ hovered = ""; });
+                group->add(widget, name);
+                return widget;
+            };
+
+        auto w1 = addWidget("w1", {0, 0}, {100, 100});
+        auto w2 = addWidget("w2", {50, 50}, {100, 100});
+        auto w3 = addWidget("w3", {300, 200}, {20, 20});
+
+        group->mouseMoved({75, 75});
+        REQUIRE(hovered == "w2");
+        group->mouseMoved({25, 25});
+        REQUIRE(hovered == "w1");
+
+        w1->moveToFront();
+        group->mouseMoved({75, 75});
+        REQUIRE(hovered == "w1");
+
+        group->mouseMoved({310, 210});
+        REQUIRE(hovered == "w3");
+
+        w3->setPosition(0, 0);
+        group->mouseMoved({311, 211});
+        REQUIRE(hovered == "");
+        group->mouseMoved({10, 10});
+        REQUIRE(hovered == "w3");
+
+        w3->setSize(200, 200);
+        group->mouseMoved({180, 180});
+        REQUIRE(hovered == "w3");
+
+        group->remove(w3);
+        group->mouseMoved({181, 181});
+        REQUIRE(hovered == "");
+        group->mouseMoved({140, 140});
+        REQUIRE(hovered == "w2");
+
+        w2->setVisible(false);
+        group->mouseMoved({60, 60});
+        REQUIRE(hovered == "w1");
+
+        // Copies use the index as well
+        auto copy = tgui::Group::copy(group);
+        REQUIRE(copy->isSpatialIndexEnabled());
+        REQUIRE(copy->getSpatialIndexCellSize() == 50);
+
+        group->setSpatialIndexEnabled(false);
+        REQUIRE(!group->isSpatialIndexEnabled());
+        group->mouseMoved({61, 61});
+        REQUIRE(hovered == "w1");
+    }
+
+    SECTION("hover cache")
+    {
+        auto group = tgui::Group::create({400, 300});
+
+        REQUIRE(!tgui::Container::isHoverCacheEnabled());
+        tgui::Container::setHoverCacheEnabled(true);
+        REQUIRE(tgui::Container::isHoverCacheEnabled());
+
+        std::string hovered;
+        auto addWidget = [&](const tgui::Container::Ptr& parent, const std::string& name, tgui::Vector2f pos, tgui::Vector2f size){
+                auto widget = tgui::ClickableWidget::create(size);
+                widget->setPosition(pos);
+                widget->connect("MouseEntered", [&hovered,name]{ hovered = name; });
+                widget->connect("MouseLeft", [&hovered]{ hovered = ""; });
+                parent->add(widget, name);
+                return widget;
+            };
+
+        auto innerGroup = tgui::Group::create({200, 200});
+        innerGroup->setPosition(100, 100);
+        group->add(innerGroup);
+
+        auto w1 = addWidget(innerGroup, "w1", {0, 0}, {100, 100});
+        auto w2 = addWidget(group, "w2", {150, 150}, {20, 20});
+        w2->setVisible(false);
+
+        group->mouseMoved({160, 160});
+        REQUIRE(hovered == "w1");
+        group->mouseMoved({161, 161});
+        REQUIRE(hovered == "w1");
+
+        // Widgets in front of the cached widget are still checked
+        w2->setVisible(true);
+        group->mouseMoved({162, 162});
+        REQUIRE(hovered == "w2");
+        w2->setVisible(false);
+        group->mouseMoved({163, 163});
+        REQUIRE(hovered == "w1");
+
+        // Changes to the z-order, position and size are detected
+        auto w3 = addWidget(innerGroup, "w3", {40, 40}, {50, 50});
+        group->mouseMoved({164, 164});
+        REQUIRE(hovered == "w3");
+        w3->moveToBack();
+        group->mouseMoved({165, 165});
+        REQUIRE(hovered == "w1");
+        w3->moveToFront();
+        group->mouseMoved({166, 166});
+        REQUIRE(hovered == "w3");
+        w3->setPosition(0, 0);
+        group->mouseMoved({167, 167});
+        REQUIRE(hovered == "w1");
+        w3->setSize(80, 80);
+        group->mouseMoved({168, 168});
+        REQUIRE(hovered == "w3");
+
+        innerGroup->remove(w3);
+        group->mouseMoved({170, 170});
+        REQUIRE(hovered == "w1");
+        group->mouseMoved({250, 250});
+        REQUIRE(hovered == "");
+
+        // Changes made while the cache is disabled aren't tracked, so the old caches aren't used when it is enabled again
+        auto w4 = addWidget(innerGroup, "w4", {150, 150}, {50, 50});
+        group->mouseMoved({170, 170});
+        REQUIRE(hovered == "w1");
+
+        tgui::Container::setHoverCacheEnabled(false);
+        REQUIRE(!tgui::Container::isHoverCacheEnabled());
+        w4->setPosition(50, 50);
+
+        tgui::Container::setHoverCacheEnabled(true);
+        group->mouseMoved({171, 171});
+        REQUIRE(hovered == "w4");
+
+        tgui::Container::setHoverCacheEnabled(false);
+        REQUIRE(!tgui::Container::isHoverCacheEnabled());
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
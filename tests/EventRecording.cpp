@@ -0,0 +1,302 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include "EventRecording.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+namespace
+{
+    unsigned int getModifiers(const sf::Event::KeyEvent& key)
+    {
+        return (key.alt ? 1 : 0) | (key.control ? 2 : 0) | (key.shift ? 4 : 0) | (key.system ? 8 : 0);
+    }
+
+    void setModifiers(sf::Event::KeyEvent& key, unsigned int modifiers)
+    {
+        key.alt = ((modifiers & 1) != 0);
+        key.control = ((modifiers & 2) != 0);
+        key.shift = ((modifiers & 4) != 0);
+        key.system = ((modifiers & 8) != 0);
+    }
+}
+
+void EventRecording::save(const std::string& filename) const
+{
+    std::ofstream file{filename};
+    if (!file)
+        throw tgui::Exception{"Failed to open '" + filename + "' for writing the events."};
+
+    for (const auto& frame : frames)
+    {
+        file << "F " << frame.elapsedTime.asMicroseconds() << '\n';
+        for (const auto& event : frame.events)
+        {
+            switch (event.type)
+            {
+                case sf::Event::MouseMoved:
+                    file << "M " << event.mouseMove.x << ' ' << event.mouseMove.y << '\n';
+                    break;
+                case sf::Event::MouseButtonPressed:
+                    file << "P " << event.mouseButton.button << ' ' << event.mouseButton.x << ' ' << event.mouseButton.y << '\n';
+                    break;
+                case sf::Event::MouseButtonReleased:
+                    file << "R " << event.mouseButton.button << ' ' << event.mouseButton.x << ' ' << event.mouseButton.y << '\n';
+                    break;
+                case sf::Event::MouseWheelScrolled:
+                    if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel)
+                        file << "W " << event.mouseWheelScroll.delta << ' ' << event.mouseWheelScroll.x << ' ' << event.mouseWheelScroll.y << '\n';
+                    break;
+                case sf::Event::KeyPressed:
+                    file << "K " << event.key.code << ' ' << getModifiers(event.key) << '\n';
+                    break;
+                case sf::Event::KeyReleased:
+                    file << "U " << event.key.code << ' ' << getModifiers(event.key) << '\n';
+                    break;
+                case sf::Event::TextEntered:
+                    file << "T " << event.text.unicode << '\n';
+                    break;
+                case sf::Event::MouseEntered:
+                    file << "E\n";
+                    break;
+                case sf::Event::MouseLeft:
+                    file << "L\n";
+                    break;
+                default: // Other events are not recorded
+                    break;
+            }
+        }
+    }
+}
+
+EventRecording EventRecording::load(const std::string& filename)
+{
+    std::ifstream file{filename};
+    if (!file)
+        throw tgui::Exception{"Failed to open '" + filename + "' for reading the events."};
+
+    EventRecording recording;
+    std::string line;
+    unsigned int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        if (line.empty() || (line[0] == '#'))
+            continue;
+
+        std::istringstream stream{line};
+        char type;
+        stream >> type;
+
+        sf::Event event;
+        int button;
+        int code;
+        unsigned int modifiers;
+        bool valid = true;
+        switch (type)
+        {
+            case 'F':
+            {
+                sf::Int64 microseconds;
+                valid = static_cast<bool>(stream >> microseconds);
+                recording.frames.push_back({sf::microseconds(microseconds), {}});
+                continue;
+            }
+            case 'M':
+                event.type = sf::Event::MouseMoved;
+                valid = static_cast<bool>(stream >> event.mouseMove.x >> event.mouseMove.y);
+                break;
+            case 'P':
+            case 'R':
+                event.type = (type == 'P') ? sf::Event::MouseButtonPressed : sf::Event::MouseButtonReleased;
+                valid = static_cast<bool>(stream >> button >> event.mouseButton.x >> event.mouseButton.y);
+                event.mouseButton.button = static_cast<sf::Mouse::Button>(button);
+                break;
+            case 'W':
+                event.type = sf::Event::MouseWheelScrolled;
+                event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+                valid = static_cast<bool>(stream >> event.mouseWheelScroll.delta >> event.mouseWheelScroll.x >> event.mouseWheelScroll.y);
+                break;
+            case 'K':
+            case 'U':
+                event.type = (type == 'K') ? sf::Event::KeyPressed : sf::Event::KeyReleased;
+                valid = static_cast<bool>(stream >> code >> modifiers);
+                event.key.code = static_cast<sf::Keyboard::Key>(code);
+                setModifiers(event.key, modifiers);
+                break;
+            case 'T':
+                event.type = sf::Event::TextEntered;
+                valid = static_cast<bool>(stream >> event.text.unicode);
+                break;
+            case 'E':
+                event.type = sf::Event::MouseEntered;
+                break;
+            case 'L':
+                event.type = sf::Event::MouseLeft;
+                break;
+            default:
+                valid = false;
+                break;
+        }
+
+        // Events always belong to a frame
+        if (!valid || recording.frames.empty())
+            throw tgui::Exception{"Invalid event on line " + tgui::to_string(lineNumber) + " of '" + filename + "'."};
+
+        recording.frames.back().events.push_back(event);
+    }
+
+    return recording;
+}
+
+void EventRecorder::startFrame()
+{
+    m_recording.frames.push_back({m_clock.restart(), {}});
+}
+
+void EventRecorder::record(const sf::Event& event)
+{
+    if (m_recording.frames.empty())
+        startFrame();
+
+    m_recording.frames.back().events.push_back(event);
+}
+
+const EventRecording& EventRecorder::getRecording() const
+{
+    return m_recording;
+}
+
+sf::Time ReplayResult::getPercentile(float percentage) const
+{
+    if (eventDurations.empty())
+        return {};
+
+    // Nearest rank: the smallest duration for which at least the requested percentage of the events was as fast or faster
+    const auto rank = static_cast<std::size_t>(std::ceil(percentage / 100.f * eventDurations.size()));
+    return eventDurations[std::min(std::max<std::size_t>(rank, 1), eventDurations.size()) - 1];
+}
+
+ReplayResult replayEvents(tgui::Gui& gui, sf::RenderTexture& target, const EventRecording& recording)
+{
+    ReplayResult result;
+    sf::Clock clock;
+    for (const auto& frame : recording.frames)
+    {
+        // The time is updated before handling the events, just like the draw call at the end of the previous frame would do
+        gui.updateTime(frame.elapsedTime);
+
+        for (const auto& event : frame.events)
+        {
+            clock.restart();
+            gui.handleEvent(event);
+            result.eventDurations.push_back(clock.getElapsedTime());
+        }
+
+        target.clear();
+        gui.draw();
+        target.display();
+    }
+
+    std::sort(result.eventDurations.begin(), result.eventDurations.end());
+    return result;
+}
+
+TEST_CASE("[EventRecording]")
+{
+    EventRecording recording;
+    recording.frames.push_back({sf::milliseconds(16), {}});
+
+    sf::Event event;
+    event.type = sf::Event::MouseMoved;
+    event.mouseMove.x = 60;
+    event.mouseMove.y = 30;
+    recording.frames.back().events.push_back(event);
+
+    event.type = sf::Event::MouseButtonPressed;
+    event.mouseButton.button = sf::Mouse::Left;
+    event.mouseButton.x = 60;
+    event.mouseButton.y = 30;
+    recording.frames.back().events.push_back(event);
+
+    recording.frames.push_back({sf::milliseconds(17), {}});
+    event.type = sf::Event::MouseButtonReleased;
+    recording.frames.back().events.push_back(event);
+
+    event.type = sf::Event::KeyPressed;
+    event.key.code = sf::Keyboard::A;
+    setModifiers(event.key, 4);
+    recording.frames.back().events.push_back(event);
+
+    event.type = sf::Event::TextEntered;
+    event.text.unicode = 'A';
+    recording.frames.back().events.push_back(event);
+
+    SECTION("Saving and loading")
+    {
+        recording.save("EventRecording.txt");
+        const EventRecording loadedRecording = EventRecording::load("EventRecording.txt");
+        REQUIRE(loadedRecording.frames.size() == 2);
+        REQUIRE(loadedRecording.frames[0].elapsedTime == sf::milliseconds(16));
+        REQUIRE(loadedRecording.frames[0].events.size() == 2);
+        REQUIRE(loadedRecording.frames[0].events[0].type == sf::Event::MouseMoved);
+        REQUIRE(loadedRecording.frames[0].events[0].mouseMove.x == 60);
+        REQUIRE(loadedRecording.frames[0].events[0].mouseMove.y == 30);
+        REQUIRE(loadedRecording.frames[0].events[1].type == sf::Event::MouseButtonPressed);
+        REQUIRE(loadedRecording.frames[1].elapsedTime == sf::milliseconds(17));
+        REQUIRE(loadedRecording.frames[1].events.size() == 3);
+        REQUIRE(loadedRecording.frames[1].events[0].type == sf::Event::MouseButtonReleased);
+        REQUIRE(loadedRecording.frames[1].events[1].key.code == sf::Keyboard::A);
+        REQUIRE(loadedRecording.frames[1].events[1].key.shift);
+        REQUIRE(!loadedRecording.frames[1].events[1].key.control);
+        REQUIRE(loadedRecording.frames[1].events[2].text.unicode == 'A');
+    }
+
+    SECTION("Replaying")
+    {
+        sf::RenderTexture target;
+        target.create(200, 100);
+        tgui::Gui gui{target};
+
+        auto button = tgui::Button::create();
+        button->setPosition(50, 20);
+        button->setSize(100, 40);
+        gui.add(button);
+
+        unsigned int clickCount = 0;
+        button->connect("Pressed", [&]{ ++clickCount; });
+
+        const ReplayResult result = replayEvents(gui, target, recording);
+        REQUIRE(clickCount == 1);
+        REQUIRE(result.eventDurations.size() == 5);
+        REQUIRE(result.getPercentile(0) == result.eventDurations.front());
+        REQUIRE(result.getPercentile(50) == result.eventDurations[2]);
+        REQUIRE(result.getPercentile(100) == result.eventDurations.back());
+    }
+}
@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TESTS_EVENT_RECORDING_HPP
+#define TGUI_TESTS_EVENT_RECORDING_HPP
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/Window/Event.hpp>
+#include <TGUI/Gui.hpp>
+#include <string>
+#include <vector>
+
+// Events that were passed to a gui, grouped per frame, which can be stored in a file and replayed later.
+// In the file, every frame starts with a line "F <microseconds since previous frame>", followed by one line per event:
+//   M x y                 mouse moved
+//   P button x y          mouse button pressed
+//   R button x y          mouse button released
+//   W delta x y           vertical mouse wheel scrolled
+//   K code modifiers      key pressed (modifiers: 1 = alt, 2 = control, 4 = shift, 8 = system)
+//   U code modifiers      key released
+//   T unicode             text entered
+//   E                     mouse entered the window
+//   L                     mouse left the window
+// Empty lines and lines starting with '#' are ignored.
+struct EventRecording
+{
+    struct Frame
+    {
+        sf::Time elapsedTime; // Time since the previous frame
+        std::vector<sf::Event> events;
+    };
+
+    std::vector<Frame> frames;
+
+    // Events of other types are not stored
+    void save(const std::string& filename) const;
+
+    // Throws a tgui::Exception when the file can't be read or contains an invalid line
+    static EventRecording load(const std::string& filename);
+};
+
+// Records the events from the event loop of an application, call startFrame before polling the events of each frame
+class EventRecorder
+{
+public:
+    void startFrame();
+    void record(const sf::Event& event);
+    const EventRecording& getRecording() const;
+
+private:
+    sf::Clock m_clock;
+    EventRecording m_recording;
+};
+
+// Durations of handling each event during a replay
+struct ReplayResult
+{
+    std::vector<sf::Time> eventDurations; // Sorted from fast to slow
+
+    // Returns the duration below which the given percentage (between 0 and 100) of the events was handled
+    sf::Time getPercentile(float percentage) const;
+};
+
+// Passes the events to the gui, with the time between the frames as recorded, and draws the gui after each frame
+ReplayResult replayEvents(tgui::Gui& gui, sf::RenderTexture& target, const EventRecording& recording);
+
+#endif // TGUI_TESTS_EVENT_RECORDING_HPP
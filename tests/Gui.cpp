@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TGUI.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <thread>
+
+TEST_CASE("[Gui]")
+{
+    SECTION("Posting tasks")
+    {
+        tgui::Gui gui;
+
+        SECTION("Order")
+        {
+            std::vector<int> order;
+            REQUIRE(gui.processPostedTasks() == 0);
+
+            gui.post([&]{ order.push_back(1); });
+            gui.post([&]{ order.push_back(2); gui.post([&]{ order.push_back(4); }); });
+            gui.post([&]{ order.push_back(3); });
+
+            // Tasks posted by tasks are only executed during the next call
+            REQUIRE(gui.processPostedTasks() == 3);
+            REQUIRE(order == std::vector<int>{1, 2, 3});
+            REQUIRE(gui.processPostedTasks() == 1);
+            REQUIRE(order == std::vector<int>{1, 2, 3, 4});
+        }
+
+        SECTION("Budget")
+        {
+            REQUIRE(gui.getPostedTaskTimeBudget() == sf::Time::Zero);
+            gui.setPostedTaskTimeBudget(sf::milliseconds(5));
+            REQUIRE(gui.getPostedTaskTimeBudget() == sf::milliseconds(5));
+
+            unsigned int count = 0;
+            for (unsigned int i = 0; i < 3; ++i)
+                gui.post([&]{ ++count; sf::sleep(sf::milliseconds(10)); });
+
+            // At least one task is always executed, but no new task is started once the budget is exceeded
+            REQUIRE(gui.processPostedTasks(sf::milliseconds(5)) == 1);
+            REQUIRE(count == 1);
+            REQUIRE(gui.processPostedTasks() == 2);
+            REQUIRE(count == 3);
+        }
+
+        SECTION("Draw")
+        {
+            sf::RenderTexture target;
+            target.create(50, 50);
+            gui.setTarget(target);
+
+            auto label = tgui::Label::create();
+            gui.add(label);
+            gui.post([=]{ label->setText("Posted"); });
+            REQUIRE(label->getText() == "");
+            gui.draw();
+            REQUIRE(label->getText() == "Posted");
+        }
+
+        SECTION("Multiple threads")
+        {
+            const unsigned int threadCount = 8;
+            const unsigned int tasksPerThread = 10000;
+
+            std::vector<unsigned int> lastValues(threadCount, 0);
+            unsigned int outOfOrderCount = 0;
+            unsigned int executedCount = 0;
+
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < threadCount; ++i)
+            {
+                threads.emplace_back([&,i]{
+                        for (unsigned int j = 1; j <= tasksPerThread; ++j)
+                        {
+                            gui.post([&,i,j]{
+                                    // Tasks posted by the same thread are executed in the order in which they were posted
+                                    if (lastValues[i] + 1 != j)
+                                        ++outOfOrderCount;
+
+                                    lastValues[i] = j;
+                                    ++executedCount;
+                                });
+                        }
+                    });
+            }
+
+            // Execute the tasks while they are being posted
+            while (executedCount < threadCount * tasksPerThread)
+                gui.processPostedTasks(sf::milliseconds(1));
+
+            for (auto& thread : threads)
+                thread.join();
+
+            REQUIRE(gui.processPostedTasks() == 0);
+            REQUIRE(executedCount == threadCount * tasksPerThread);
+            REQUIRE(outOfOrderCount == 0);
+        }
+    }
+
+    SECTION("Coalescing mouse moves")
+    {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto widget = tgui::ClickableWidget::create({50, 50});
+        widget->setPosition(100, 100);
+        gui.add(widget);
+
+        unsigned int mouseEnteredCount = 0;
+        unsigned int mouseLeftCount = 0;
+        unsigned int clickedCount = 0;
+        widget->connect("MouseEntered", [&]{ ++mouseEnteredCount; });
+        widget->connect("MouseLeft", [&]{ ++mouseLeftCount; });
+        widget->connect("Clicked", [&]{ ++clickedCount; });
+
+        auto mouseMove = [&](int x, int y){
+                sf::Event event;
+                event.type = sf::Event::MouseMoved;
+                event.mouseMove.x = x;
+                event.mouseMove.y = y;
+                return gui.handleEvent(event);
+            };
+        auto mouseButton = [&](sf::Event::EventType type, int x, int y){
+                sf::Event event;
+                event.type = type;
+                event.mouseButton.button = sf::Mouse::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+                gui.handleEvent(event);
+            };
+
+        REQUIRE(!gui.isMouseMoveCoalescing());
+        gui.setMouseMoveCoalescing(true);
+        REQUIRE(gui.isMouseMoveCoalescing());
+
+        SECTION("Only the last position is handled")
+        {
+            // Moving in and out of the widget within a single frame doesn't trigger any signal
+            REQUIRE(!mouseMove(10, 10));
+            REQUIRE(!mouseMove(120, 120));
+            REQUIRE(!mouseMove(20, 20));
+            REQUIRE(!gui.processCoalescedMouseMove());
+            REQUIRE(mouseEnteredCount == 0);
+            REQUIRE(gui.getCoalescedMousePath() == std::vector<tgui::Vector2f>{{10, 10}, {120, 120}, {20, 20}});
+
+            mouseMove(110, 110);
+            mouseMove(120, 120);
+            REQUIRE(mouseEnteredCount == 0);
+            gui.draw();
+            REQUIRE(mouseEnteredCount == 1);
+            REQUIRE(gui.getCoalescedMousePath() == std::vector<tgui::Vector2f>{{110, 110}, {120, 120}});
+
+            // Nothing is waiting to be handled anymore
+            REQUIRE(!gui.processCoalescedMouseMove());
+            REQUIRE(mouseLeftCount == 0);
+        }
+
+        SECTION("Other events are handled in order")
+        {
+            // The pending move is handled before the mouse press, so the press happens on top of the widget
+            mouseMove(10, 10);
+            mouseMove(120, 120);
+            mouseButton(sf::Event::MouseButtonPressed, 120, 120);
+            REQUIRE(mouseEnteredCount == 1);
+
+            mouseMove(130, 130);
+            mouseButton(sf::Event::MouseButtonReleased, 130, 130);
+            REQUIRE(clickedCount == 1);
+
+            mouseMove(10, 10);
+            REQUIRE(mouseLeftCount == 0);
+            gui.setMouseMoveCoalescing(false);
+            REQUIRE(mouseLeftCount == 1);
+
+            // Without coalescing, every move is handled immediately
+            mouseMove(120, 120);
+            REQUIRE(mouseEnteredCount == 2);
+        }
+    }
+}
@@ -405,6 +405,119 @@ TEST_CASE("[Layouts]")
             widget->setPosition({"0"},{"0"});
             widget->setPosition("0","0");
         }
+
+        SECTION("Same string in different widgets")
+        {
+            auto panel1 = tgui::Panel::create({200, 100});
+            auto panel2 = tgui::Panel::create({400, 300});
+
+            auto button1 = tgui::Button::create();
+            auto button2 = tgui::Button::create();
+            button1->setSize({"parent.width - 20", "50%"});
+            button2->setSize({"parent.width - 20", "50%"});
+            panel1->add(button1);
+            panel2->add(button2);
+            REQUIRE(button1->getSize() == sf::Vector2f(180, 50));
+            REQUIRE(button2->getSize() == sf::Vector2f(380, 150));
+
+            // A copy of the layout refers to the parent of the widget to which it is given
+            auto button3 = tgui::Button::create();
+            button3->setSize(button2->getSizeLayout());
+            panel1->add(button3);
+            REQUIRE(button3->getSize() == sf::Vector2f(180, 50));
+
+            panel1->setSize({300, 200});
+            REQUIRE(button1->getSize() == sf::Vector2f(280, 100));
+            REQUIRE(button2->getSize() == sf::Vector2f(380, 150));
+            REQUIRE(button3->getSize() == sf::Vector2f(280, 100));
+            REQUIRE(button3->getSizeLayout().toString() == "(parent.width - 20, 50%)");
+        }
+
+        SECTION("More strings than can be cached")
+        {
+            const tgui::Layout layout{"10 + 5"};
+            for (unsigned int i = 0; i < 1100; ++i)
+            {
+                REQUIRE(tgui::Layout{"10 + 5"}.getValue() == 15);
+                REQUIRE(tgui::Layout{tgui::to_string(i) + " * 2"}.getValue() == i * 2);
+            }
+
+            for (unsigned int i = 0; i < 1100; ++i)
+                REQUIRE(tgui::Layout{tgui::to_string(i) + " * 2"}.getValue() == i * 2);
+
+            REQUIRE(layout.getValue() == 15);
+        }
+    }
+
+    SECTION("Deferred resolution")
+    {
+        auto panel = tgui::Panel::create({400, 300});
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        panel->add(button1);
+        panel->add(button2);
+        panel->add(button3);
+
+        tgui::Gui gui;
+        gui.add(panel);
+        REQUIRE(!gui.isDeferredLayoutResolution());
+        gui.setDeferredLayoutResolution(true);
+        REQUIRE(gui.isDeferredLayoutResolution());
+
+        button1->setSize({"parent.width / 2", 50});
+        button2->setSize(bindWidth(button1), bindHeight(button1) * 2);
+        button3->setSize(bindWidth(button1) + bindWidth(button2), 20);
+        REQUIRE(button1->getSize() == sf::Vector2f(200, 50));
+        REQUIRE(button2->getSize() == sf::Vector2f(200, 100));
+        REQUIRE(button3->getSize() == sf::Vector2f(400, 20));
+        REQUIRE(gui.updateLayouts() == 0);
+
+        // Widgets that depend on the panel are only updated when the layouts are resolved
+        panel->setSize(600, 300);
+        REQUIRE(button1->getSize() == sf::Vector2f(200, 50));
+        REQUIRE(button3->getSize() == sf::Vector2f(400, 20));
+
+        // Button3 depends on both other buttons but is only recalculated once
+        REQUIRE(gui.updateLayouts() == 3);
+        REQUIRE(button1->getSize() == sf::Vector2f(300, 50));
+        REQUIRE(button2->getSize() == sf::Vector2f(300, 100));
+        REQUIRE(button3->getSize() == sf::Vector2f(600, 20));
+        REQUIRE(gui.updateLayouts() == 0);
+
+        // Widgets that depend on each other are recalculated only once per call
+        auto button4 = tgui::Button::create();
+        auto button5 = tgui::Button::create();
+        panel->add(button4);
+        panel->add(button5);
+        button4->setSize(bindWidth(button5), 50);
+        const float width = button4->getSize().x;
+        button5->setSize(bindWidth(button4) + 1, 50);
+        REQUIRE(gui.updateLayouts() == 2);
+        REQUIRE(button4->getSize().x == width + 1);
+        REQUIRE(button5->getSize().x == width + 2);
+
+        // Widgets that are removed from the gui no longer wait for the gui to resolve their layouts
+        button5->setSize(20, 50);
+        REQUIRE(button4->getSize().x == width + 1);
+        panel->remove(button4);
+        REQUIRE(button4->getSize().x == 20);
+        panel->add(button4);
+
+        // Layouts in other guis are still resolved immediately
+        tgui::Gui otherGui;
+        auto otherButton1 = tgui::Button::create();
+        auto otherButton2 = tgui::Button::create();
+        otherGui.add(otherButton1);
+        otherGui.add(otherButton2);
+        otherButton2->setSize(bindWidth(otherButton1), 50);
+        otherButton1->setSize(30, 50);
+        REQUIRE(otherButton2->getSize().x == 30);
+
+        // Disabling the deferred mode resolves the remaining layouts
+        button5->setSize(10, 50);
+        gui.setDeferredLayoutResolution(false);
+        REQUIRE(button4->getSize().x == 10);
     }
 
     SECTION("Bug Fixes")
@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <thread>
 
 // TODO: Reloading theme
 
@@ -148,6 +149,27 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("Multiple threads")
+    {
+        tgui::Theme theme{"resources/Black.txt"};
+
+        const unsigned int threadCount = 8;
+        std::vector<std::shared_ptr<tgui::RendererData>> renderers(threadCount);
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+            threads.emplace_back([&,i]{ renderers[i] = theme.getRenderer("Button"); });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // Renderers are still shared when they were requested for the first time from different threads
+        REQUIRE(renderers[0] != nullptr);
+        for (unsigned int i = 1; i < threadCount; ++i)
+            REQUIRE(renderers[i] == renderers[0]);
+        REQUIRE(theme.getRenderer("Button") == renderers[0]);
+    }
+
     SECTION("setThemeLoader")
     {
         struct CustomThemeLoader : public tgui::BaseThemeLoader
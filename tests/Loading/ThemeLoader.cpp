@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <thread>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -188,5 +189,30 @@ TEST_CASE("[ThemeLoader]")
             tgui::DefaultThemeLoader::flushCache();
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
         }
+
+        SECTION("multiple threads")
+        {
+            const unsigned int threadCount = 8;
+            std::vector<std::map<sf::String, sf::String>> properties(threadCount);
+
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < threadCount; ++i)
+                threads.emplace_back([&,i]{ properties[i] = loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots"); });
+
+            for (auto& thread : threads)
+                thread.join();
+
+            for (unsigned int i = 0; i < threadCount; ++i)
+            {
+                REQUIRE(properties[i].size() == 2);
+                REQUIRE(properties[i]["textcolor"] == "rgb(0, 255, 0)");
+            }
+
+            // The file is only stored once, even when multiple threads parsed it at the same time
+            REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 1);
+
+            tgui::DefaultThemeLoader::flushCache();
+            REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
+        }
     }
 }
@@ -24,6 +24,43 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <thread>
+
+namespace
+{
+    // Signal handler that counts how many times it is called and copied, to check that emitting doesn't copy the handlers
+    struct CountingHandler
+    {
+        CountingHandler(unsigned int& callCount, unsigned int& copyCount) :
+            calls(&callCount),
+            copies(&copyCount)
+        {
+        }
+
+        CountingHandler(const CountingHandler& other) :
+            calls(other.calls),
+            copies(other.copies)
+        {
+            ++*copies;
+        }
+
+        CountingHandler& operator=(const CountingHandler& other)
+        {
+            calls = other.calls;
+            copies = other.copies;
+            ++*copies;
+            return *this;
+        }
+
+        void operator()() const
+        {
+            ++*calls;
+        }
+
+        unsigned int* calls;
+        unsigned int* copies;
+    };
+}
 
 TEST_CASE("[Signal]")
 {
@@ -64,6 +101,12 @@ TEST_CASE("[Signal]")
 
         REQUIRE_THROWS_AS(widget->connect("SomeInvalidSignal", [](){}), tgui::Exception);
 
+        // Signal names are case-insensitive
+        REQUIRE(widget->connect("positionchanged", [](){}) == ++id);
+        REQUIRE(widget->connect("MOUSELEFT", [](){}) == ++id);
+        REQUIRE(widget->connect("Clicked", [](){}) == ++id);
+        REQUIRE_THROWS_AS(widget->connect("Pressed", [](){}), tgui::Exception);
+
         tgui::Widget::Ptr widget2 = tgui::Button::create();
         REQUIRE(widget2->connect("Pressed", [](){}) == ++id);
         REQUIRE(widget2->connect("Pressed", [](int){}, 5) == ++id);
@@ -142,4 +185,119 @@ TEST_CASE("[Signal]")
         widget->setSize(400, 100);
         REQUIRE(i == 4);
     }
+
+    SECTION("emit")
+    {
+        SECTION("No copies")
+        {
+            unsigned int calls = 0;
+            unsigned int copies = 0;
+            widget->connect("PositionChanged", CountingHandler{calls, copies});
+            widget->connect("PositionChanged", CountingHandler{calls, copies});
+            widget->onPositionChange.emit(widget.get(), {0, 0});
+
+            const unsigned int copiesBefore = copies;
+            for (unsigned int i = 0; i < 100; ++i)
+                widget->onPositionChange.emit(widget.get(), {1, 0});
+
+            REQUIRE(copies == copiesBefore);
+            REQUIRE(calls == 202);
+        }
+
+        SECTION("Changing handlers while emitting")
+        {
+            unsigned int count1 = 0;
+            unsigned int count2 = 0;
+            unsigned int count3 = 0;
+            unsigned int id2 = 0;
+            widget->connect("Focused", [&]{
+                    ++count1;
+                    if (count1 == 1)
+                    {
+                        widget->disconnect(id2);
+                        widget->connect("Focused", [&]{ ++count3; });
+                    }
+                });
+            id2 = widget->connect("Focused", [&]{ ++count2; });
+
+            // A disconnected handler is no longer called, a new handler is only called from the next emit onwards
+            widget->onFocus.emit(widget.get());
+            REQUIRE(count1 == 1);
+            REQUIRE(count2 == 0);
+            REQUIRE(count3 == 0);
+
+            widget->onFocus.emit(widget.get());
+            REQUIRE(count1 == 2);
+            REQUIRE(count2 == 0);
+            REQUIRE(count3 == 1);
+        }
+
+        SECTION("Destroying widget in handler")
+        {
+            unsigned int count = 0;
+            tgui::Widget* widgetPtr = widget.get();
+            widget->connect("MouseEntered", [&]{ ++count; widget = nullptr; });
+            widget->connect("MouseEntered", [&]{ ++count; });
+            REQUIRE(widgetPtr->onMouseEnter.emit(widgetPtr));
+            REQUIRE(widget == nullptr);
+            REQUIRE(count == 2);
+        }
+
+        SECTION("Typed handlers")
+        {
+            std::vector<std::string> calls;
+            widget->onPositionChange.connect([&](tgui::Vector2f pos){ REQUIRE(pos == tgui::Vector2f{10, 20}); calls.push_back("typed"); });
+            widget->connect("PositionChanged", [&](sf::Vector2f pos){ REQUIRE(pos == sf::Vector2f{10, 20}); calls.push_back("name"); });
+            const unsigned int id = widget->onPositionChange.connect([&](tgui::Widget::Ptr w, const std::string& signalName, tgui::Vector2f){
+                    REQUIRE(w == widget);
+                    REQUIRE(signalName == "PositionChanged");
+                    calls.push_back("typedEx");
+                });
+
+            // Handlers are called in the order in which they were connected, regardless of how they were connected
+            widget->setPosition(10, 20);
+            REQUIRE(calls == std::vector<std::string>{"typed", "name", "typedEx"});
+
+            REQUIRE(widget->onPositionChange.disconnect(id));
+            REQUIRE(!widget->onPositionChange.disconnect(id));
+            widget->onPositionChange.emit(widget.get(), {10, 20});
+            REQUIRE(calls.size() == 5);
+        }
+
+        SECTION("Multiple threads")
+        {
+            // The parameters are passed to the handlers of each emit, so each thread can emit the signal of its own widget
+            const unsigned int iterations = 10000;
+            std::vector<tgui::Widget::Ptr> widgets;
+            std::vector<unsigned int> counts(4, 0);
+            std::vector<unsigned int> errors(4, 0);
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                widgets.push_back(tgui::ClickableWidget::create());
+                widgets[i]->connect("SizeChanged", [&counts,&errors,i](sf::Vector2f size){
+                        ++counts[i];
+                        if (size.x != static_cast<float>(i))
+                            ++errors[i];
+                    });
+            }
+
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                threads.emplace_back([&widgets,i]{
+                        for (unsigned int j = 0; j < iterations; ++j)
+                            widgets[i]->onSizeChange.emit(widgets[i].get(), {static_cast<float>(i), static_cast<float>(j)});
+                    });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                REQUIRE(counts[i] == iterations);
+                REQUIRE(errors[i] == 0);
+            }
+        }
+    }
 }
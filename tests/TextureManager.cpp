@@ -27,6 +27,7 @@
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
 #include <SFML/System/Err.hpp>
+#include <thread>
 
 TEST_CASE("[TextureManager]")
 {
@@ -52,4 +53,28 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    SECTION("Multiple threads")
+    {
+        const unsigned int threadCount = 8;
+        std::vector<tgui::Texture> textures(threadCount);
+        std::vector<std::shared_ptr<tgui::TextureData>> textureData(threadCount);
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+            threads.emplace_back([&,i]{ textureData[i] = tgui::TextureManager::getTexture(textures[i], "resources/Texture1.png"); });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // All threads get the same data, even when they loaded the image at the same time
+        REQUIRE(textureData[0] != nullptr);
+        for (unsigned int i = 1; i < threadCount; ++i)
+            REQUIRE(textureData[i] == textureData[0]);
+
+        // Every thread was counted as a user of the texture
+        for (unsigned int i = 0; i < threadCount; ++i)
+            REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData[0]));
+        REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData[0]), tgui::Exception);
+    }
 }
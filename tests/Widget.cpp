@@ -77,6 +77,34 @@ TEST_CASE("[Widget]")
         REQUIRE(widget->getParent() == nullptr);
     }
 
+    SECTION("Gui container")
+    {
+        auto panel = tgui::Panel::create();
+        panel->add(widget);
+        REQUIRE(widget->getGuiContainer() == nullptr);
+
+        auto gui = std::make_unique<tgui::Gui>();
+        gui->add(panel);
+        REQUIRE(panel->getGuiContainer() == gui->getContainer().get());
+        REQUIRE(widget->getGuiContainer() == gui->getContainer().get());
+
+        gui->remove(panel);
+        REQUIRE(widget->getGuiContainer() == nullptr);
+
+        gui->add(panel);
+        auto otherPanel = tgui::Panel::create();
+        panel->remove(widget);
+        otherPanel->add(widget);
+        REQUIRE(widget->getGuiContainer() == nullptr);
+        panel->add(otherPanel);
+        REQUIRE(widget->getGuiContainer() == gui->getContainer().get());
+
+        // The widgets are no longer part of the gui once it is destroyed
+        gui = nullptr;
+        REQUIRE(panel->getGuiContainer() == nullptr);
+        REQUIRE(widget->getGuiContainer() == nullptr);
+    }
+
     SECTION("Move to front/back")
     {
         auto widget1 = tgui::ClickableWidget::create();
@@ -220,6 +248,152 @@ TEST_CASE("[Widget]")
         REQUIRE(widget4->getSize() == sf::Vector2f(400*0.3f, 300*0.05f));
     }
 
+    SECTION("Coalesced geometry signals")
+    {
+        tgui::Gui gui;
+        auto container = tgui::Panel::create();
+        container->setSize(400, 300);
+        container->add(widget);
+        gui.add(container);
+        widget->setSize("50%", "50%");
+
+        unsigned int positionCount = 0;
+        unsigned int sizeCount = 0;
+        sf::Vector2f lastSize;
+        widget->connect("PositionChanged", [&]{ ++positionCount; });
+        widget->connect("SizeChanged", [&](sf::Vector2f size){ ++sizeCount; lastSize = size; });
+
+        REQUIRE(!gui.isCoalescedGeometrySignals());
+        gui.setCoalescedGeometrySignals(true);
+        REQUIRE(gui.isCoalescedGeometrySignals());
+
+        container->setSize(200, 100);
+        container->setSize(300, 200);
+        container->setSize(600, 400);
+        REQUIRE(widget->getSize() == sf::Vector2f(300, 200));
+        REQUIRE(sizeCount == 0);
+
+        gui.updateLayouts();
+        REQUIRE(sizeCount == 1);
+        REQUIRE(lastSize == sf::Vector2f(300, 200));
+        REQUIRE(positionCount == 0);
+        gui.updateLayouts();
+        REQUIRE(sizeCount == 1);
+
+        // Widgets that aren't part of the gui emit their signals immediately
+        auto widget2 = tgui::ClickableWidget::create();
+        widget2->connect("PositionChanged", [&]{ ++positionCount; });
+        widget2->setPosition(10, 20);
+        REQUIRE(positionCount == 1);
+
+        // A widget that is removed from the gui no longer emits its pending signals
+        container->add(widget2);
+        widget2->setPosition(20, 20);
+        widget->setPosition(20, 10);
+        container->remove(widget2);
+        gui.updateLayouts();
+        REQUIRE(positionCount == 2);
+
+        // Other guis don't coalesce the signals
+        tgui::Gui otherGui;
+        otherGui.add(widget2);
+        widget2->setPosition(30, 20);
+        REQUIRE(positionCount == 3);
+
+        // Disabling the coalesced mode emits the remaining signals
+        widget->setPosition(30, 10);
+        gui.setCoalescedGeometrySignals(false);
+        REQUIRE(!gui.isCoalescedGeometrySignals());
+        REQUIRE(positionCount == 4);
+
+        widget->setPosition(40, 10);
+        REQUIRE(positionCount == 5);
+    }
+
+    SECTION("Scheduled updates")
+    {
+        tgui::Gui gui;
+        auto container = tgui::Panel::create();
+        gui.add(container);
+        for (unsigned int i = 0; i < 100; ++i)
+            container->add(tgui::ClickableWidget::create());
+
+        // Every widget gets one update when it is added to the gui, afterwards only the widgets that requested one are updated
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 101);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::seconds(1)) == 0);
+
+        // A focused edit box is only updated when its caret has to blink
+        auto editBox = tgui::EditBox::create();
+        container->add(editBox);
+        editBox->setFocused(true);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(499)) == 0);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(1)) == 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(499)) == 0);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(1)) == 1);
+
+        // The pending update still happens after unfocusing, but no new one is scheduled
+        editBox->setFocused(false);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(500)) == 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::seconds(5)) == 0);
+
+        // Removed widgets are no longer updated, until they are added to the gui again
+        editBox->setFocused(true);
+        container->remove(editBox);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::seconds(1)) == 0);
+        editBox->setFocused(true);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::seconds(1)) == 0);
+        container->add(editBox);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 1);
+        container->remove(editBox);
+
+        // Another gui has its own scheduler
+        tgui::Gui otherGui;
+        otherGui.add(editBox);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::seconds(1)) == 0);
+        REQUIRE(otherGui.getContainer()->updateScheduledWidgets({}) == 1);
+        REQUIRE(otherGui.getContainer()->getSchedulerTime() == sf::Time::Zero);
+
+        // Animations are updated every frame until they finish
+        auto panel = tgui::Panel::create();
+        gui.add(panel);
+        panel->add(widget);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 2);
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(60)) == 1);
+        REQUIRE(widget->getInheritedOpacity() > 0);
+        REQUIRE(widget->getInheritedOpacity() < 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(60)) == 1);
+        REQUIRE(widget->getInheritedOpacity() == 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(80)) == 0);
+
+        // Widgets in a hidden parent aren't updated, they are scheduled again when the parent is shown
+        panel->setVisible(false);
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(60)) == 0);
+        REQUIRE(widget->getInheritedOpacity() == 0);
+        panel->setVisible(true);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(60)) == 2);
+        REQUIRE(widget->getInheritedOpacity() > 0);
+        REQUIRE(widget->getInheritedOpacity() < 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets(sf::milliseconds(60)) == 1);
+        REQUIRE(widget->getInheritedOpacity() == 1);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 0);
+
+        // Showing a widget that was already visible doesn't schedule an update
+        panel->setVisible(true);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 0);
+
+        // Removing widgets takes their updates out of the queue without disturbing the others
+        gui.remove(container);
+        gui.add(container);
+        const auto children = container->getWidgets();
+        for (std::size_t i = 0; i < children.size(); i += 2)
+            container->remove(children[i]);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 1 + children.size() / 2);
+        REQUIRE(gui.getContainer()->updateScheduledWidgets({}) == 0);
+    }
+
     SECTION("Renderer")
     {
         auto renderer = widget->getRenderer();
@@ -217,6 +217,36 @@ TEST_CASE("[ComboBox]")
         REQUIRE(!comboBox->containsId("1"));
     }
     
+    SECTION("Search index")
+    {
+        comboBox->setSearchIndexEnabled(true);
+        REQUIRE(comboBox->isSearchIndexEnabled());
+
+        comboBox->addItem("MSFT", "1");
+        comboBox->addItem("AAPL", "2");
+        comboBox->addItem("AMZN", "3");
+        REQUIRE(comboBox->findItemsWithPrefix("a") == std::vector<std::size_t>{1, 2});
+        REQUIRE(comboBox->findItemsWithPrefix("a", 1) == std::vector<std::size_t>{1});
+
+        REQUIRE(comboBox->setSelectedItem("AMZN"));
+        REQUIRE(comboBox->getSelectedItemId() == "3");
+
+        unsigned int itemSelectedCount = 0;
+        comboBox->connect("ItemSelected", [&](){ itemSelectedCount++; });
+
+        comboBox->textEntered('m');
+        REQUIRE(comboBox->getSelectedItem() == "AMZN");
+        REQUIRE(itemSelectedCount == 0);
+
+        REQUIRE(!comboBox->isTypeAheadEnabled());
+        comboBox->setTypeAheadEnabled(true);
+        REQUIRE(comboBox->isTypeAheadEnabled());
+
+        comboBox->textEntered('m');
+        REQUIRE(comboBox->getSelectedItem() == "MSFT");
+        REQUIRE(itemSelectedCount == 1);
+    }
+
     SECTION("ItemsToDisplay")
     {
         comboBox->setItemsToDisplay(5);
@@ -0,0 +1,195 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/FlexLayout.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+TEST_CASE("[FlexLayout]")
+{
+    auto layout = tgui::FlexLayout::create({300, 100});
+    layout->setPosition(20, 10);
+
+    auto w1 = tgui::ClickableWidget::create({50, 20});
+    auto w2 = tgui::ClickableWidget::create({50, 30});
+    auto w3 = tgui::ClickableWidget::create({100, 40});
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(layout->getWidgetType() == "FlexLayout");
+    }
+
+    SECTION("Properties")
+    {
+        REQUIRE(layout->getDirection() == tgui::FlexLayout::Direction::Row);
+        REQUIRE(!layout->getWrap());
+        REQUIRE(layout->getJustification() == tgui::FlexLayout::Justification::Start);
+        REQUIRE(layout->getAlignment() == tgui::FlexLayout::Alignment::Stretch);
+
+        layout->setDirection(tgui::FlexLayout::Direction::Column);
+        layout->setWrap(true);
+        layout->setJustification(tgui::FlexLayout::Justification::SpaceBetween);
+        layout->setAlignment(tgui::FlexLayout::Alignment::Center);
+        REQUIRE(layout->getDirection() == tgui::FlexLayout::Direction::Column);
+        REQUIRE(layout->getWrap());
+        REQUIRE(layout->getJustification() == tgui::FlexLayout::Justification::SpaceBetween);
+        REQUIRE(layout->getAlignment() == tgui::FlexLayout::Alignment::Center);
+
+        layout->add(w1);
+        REQUIRE(layout->getItemGrow(w1) == 0);
+        REQUIRE(layout->getItemShrink(w1) == 1);
+        REQUIRE(layout->getItemBasis(w1) < 0);
+        REQUIRE(layout->getItemMinimumSize(w1) == sf::Vector2f(0, 0));
+        REQUIRE(layout->getItemMaximumSize(w1) == sf::Vector2f(0, 0));
+
+        REQUIRE(layout->setItemGrow(w1, 2));
+        REQUIRE(layout->setItemShrink(w1, 3));
+        REQUIRE(layout->setItemBasis(w1, 40));
+        REQUIRE(layout->setItemMinimumSize(w1, {10, 15}));
+        REQUIRE(layout->setItemMaximumSize(w1, {60, 70}));
+        REQUIRE(layout->getItemGrow(w1) == 2);
+        REQUIRE(layout->getItemShrink(w1) == 3);
+        REQUIRE(layout->getItemBasis(w1) == 40);
+        REQUIRE(layout->getItemMinimumSize(w1) == sf::Vector2f(10, 15));
+        REQUIRE(layout->getItemMaximumSize(w1) == sf::Vector2f(60, 70));
+
+        // Widgets that aren't part of the layout
+        REQUIRE(!layout->setItemGrow(w2, 1));
+        REQUIRE(layout->getItemGrow(w2) == 0);
+    }
+
+    SECTION("Growing and shrinking")
+    {
+        layout->add(w1);
+        layout->add(w2);
+        layout->add(w3);
+        REQUIRE(w1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(w2->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(w3->getPosition() == sf::Vector2f(100, 0));
+        REQUIRE(w1->getSize() == sf::Vector2f(50, 100));
+        REQUIRE(w3->getSize() == sf::Vector2f(100, 100));
+
+        layout->setItemGrow(w1, 1);
+        layout->setItemGrow(w3, 3);
+        REQUIRE(w2->getPosition() == sf::Vector2f(75, 0));
+        REQUIRE(w3->getPosition() == sf::Vector2f(125, 0));
+        REQUIRE(w1->getSize() == sf::Vector2f(75, 100));
+        REQUIRE(w3->getSize() == sf::Vector2f(175, 100));
+
+        // The space that a widget can't use because of its maximum size goes to the other widgets
+        layout->setItemMaximumSize(w3, {150, 0});
+        REQUIRE(w1->getSize() == sf::Vector2f(100, 100));
+        REQUIRE(w2->getPosition() == sf::Vector2f(100, 0));
+        REQUIRE(w3->getPosition() == sf::Vector2f(150, 0));
+        REQUIRE(w3->getSize() == sf::Vector2f(150, 100));
+
+        // Widgets shrink proportional to their basis when they don't fit
+        layout->setSize({150, 100});
+        REQUIRE(w1->getSize() == sf::Vector2f(37.5f, 100));
+        REQUIRE(w2->getSize() == sf::Vector2f(37.5f, 100));
+        REQUIRE(w3->getSize() == sf::Vector2f(75, 100));
+        REQUIRE(w3->getPosition() == sf::Vector2f(75, 0));
+
+        layout->setItemMinimumSize(w1, {45, 0});
+        REQUIRE(w1->getSize() == sf::Vector2f(45, 100));
+        REQUIRE(w2->getSize() == sf::Vector2f(35, 100));
+        REQUIRE(w3->getSize() == sf::Vector2f(70, 100));
+
+        layout->remove(w1);
+        REQUIRE(w2->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(w2->getSize() == sf::Vector2f(50, 100));
+        REQUIRE(w3->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(w3->getSize() == sf::Vector2f(100, 100));
+
+        // Resizing a widget from outside the layout changes its basis
+        w2->setSize({30, 20});
+        REQUIRE(w2->getSize() == sf::Vector2f(30, 100));
+        REQUIRE(w3->getPosition() == sf::Vector2f(30, 0));
+        REQUIRE(w3->getSize() == sf::Vector2f(120, 100));
+    }
+
+    SECTION("Wrapping and alignment")
+    {
+        layout->setSize({200, 100});
+        layout->setWrap(true);
+        layout->setAlignment(tgui::FlexLayout::Alignment::Start);
+        layout->getRenderer()->setSpaceBetweenWidgets(10);
+
+        w1->setSize({80, 30});
+        w2->setSize({80, 40});
+        w3->setSize({80, 20});
+        layout->addMultiple({w1, w2, w3});
+        REQUIRE(w1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(w2->getPosition() == sf::Vector2f(90, 0));
+        REQUIRE(w3->getPosition() == sf::Vector2f(0, 50));
+        REQUIRE(w1->getSize() == sf::Vector2f(80, 30));
+        REQUIRE(w2->getSize() == sf::Vector2f(80, 40));
+
+        layout->setJustification(tgui::FlexLayout::Justification::End);
+        REQUIRE(w1->getPosition() == sf::Vector2f(30, 0));
+        REQUIRE(w2->getPosition() == sf::Vector2f(120, 0));
+        REQUIRE(w3->getPosition() == sf::Vector2f(120, 50));
+
+        layout->setAlignment(tgui::FlexLayout::Alignment::Center);
+        REQUIRE(w1->getPosition() == sf::Vector2f(30, 5));
+        REQUIRE(w2->getPosition() == sf::Vector2f(120, 0));
+
+        layout->setJustification(tgui::FlexLayout::Justification::Start);
+        layout->setAlignment(tgui::FlexLayout::Alignment::Start);
+        layout->setDirection(tgui::FlexLayout::Direction::Column);
+        REQUIRE(w1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(w2->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(w3->getPosition() == sf::Vector2f(90, 0));
+    }
+
+    testWidgetRenderer(layout->getRenderer());
+    SECTION("Renderer")
+    {
+        auto renderer = layout->getRenderer();
+        renderer->setSpaceBetweenWidgets(15);
+        renderer->setPadding({1, 2, 3, 4});
+        REQUIRE(renderer->getSpaceBetweenWidgets() == 15);
+        REQUIRE(renderer->getPadding() == tgui::Padding(1, 2, 3, 4));
+    }
+
+    SECTION("Saving and loading from file")
+    {
+        layout->setWrap(true);
+        layout->setJustification(tgui::FlexLayout::Justification::SpaceAround);
+        layout->setAlignment(tgui::FlexLayout::Alignment::End);
+        layout->getRenderer()->setSpaceBetweenWidgets(5);
+
+        layout->add(w1);
+        layout->add(w2);
+        layout->add(w3);
+        layout->setItemGrow(w1, 1);
+        layout->setItemShrink(w2, 0);
+        layout->setItemBasis(w3, 120);
+        layout->setItemMinimumSize(w1, {10, 15});
+        layout->setItemMaximumSize(w1, {200, 80});
+
+        testSavingWidget("FlexLayout", layout, false);
+    }
+}
@@ -25,6 +25,8 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <sstream>
 
 TEST_CASE("[Grid]")
 {
@@ -74,6 +76,88 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidget(1, 5) == widget);
         grid->removeAllWidgets();
         REQUIRE(grid->getWidget(1, 5) == nullptr);
+
+        // Removing the widest and tallest widget shrinks its row and column
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+        auto widget3 = tgui::ClickableWidget::create({40, 30});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+        grid->addWidget(widget3, 1, 0);
+        REQUIRE(grid->getSize() == sf::Vector2f(120, 80));
+
+        grid->remove(widget1);
+        REQUIRE(grid->getWidget(0, 0) == widget2);
+        REQUIRE(grid->getSize() == sf::Vector2f(40, 40));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(10, 0));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(0, 10));
+    }
+
+    SECTION("Batched updates")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+
+        grid->beginUpdate();
+        REQUIRE(grid->isUpdating());
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 1, 0);
+
+        // Nothing is recalculated until endUpdate is called
+        REQUIRE(grid->getSize() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(0, 0));
+
+        grid->endUpdate();
+        REQUIRE(!grid->isUpdating());
+        REQUIRE(grid->getSize() == sf::Vector2f(100, 60));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(40, 50));
+    }
+
+    SECTION("Failed loading")
+    {
+        // The exception from load is passed on, the batch that load started is ended while the exception is thrown
+        auto container = tgui::Group::create();
+        REQUIRE_THROWS_AS(container->loadWidgetsFromStream(std::stringstream{"Grid.Grid1 { ClickableWidget.Widget1 { } GridWidgets = [\"(0, 0, (0, 0, 0, 0), Invalid)\"]; }"}), tgui::Exception);
+    }
+
+    SECTION("Resizing widgets")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+        auto widget3 = tgui::ClickableWidget::create({40, 30});
+        auto widget4 = tgui::ClickableWidget::create({30, 20});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+        grid->addWidget(widget3, 1, 0);
+        grid->addWidget(widget4, 1, 1);
+
+        REQUIRE(grid->getSize() == sf::Vector2f(130, 80));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(105, 20));
+        REQUIRE(widget4->getPosition() == sf::Vector2f(100, 55));
+
+        // Making a row higher moves the rows below it
+        widget2->setSize({20, 60});
+        REQUIRE(grid->getSize() == sf::Vector2f(130, 90));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 5));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(105, 0));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(30, 60));
+        REQUIRE(widget4->getPosition() == sf::Vector2f(100, 65));
+
+        // Making a column narrower moves the columns behind it
+        widget1->setSize({50, 50});
+        REQUIRE(grid->getSize() == sf::Vector2f(80, 90));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 5));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(55, 0));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(5, 60));
+        REQUIRE(widget4->getPosition() == sf::Vector2f(50, 65));
+
+        // A widget can only be located in one cell
+        grid->addWidget(widget4, 2, 0);
+        REQUIRE(grid->getWidget(1, 1) == nullptr);
+        REQUIRE(grid->getWidget(2, 0) == widget4);
+        REQUIRE(grid->getWidgetLocations()[widget4] == std::make_pair<std::size_t, std::size_t>(2, 0));
+        REQUIRE(grid->getWidgetLocations().size() == 4);
     }
 
     SECTION("Borders")
@@ -94,6 +94,53 @@ TEST_CASE("[HorizontalWrap]")
         REQUIRE(pic8->getPosition() == sf::Vector2f(0, 160));
     }
 
+    SECTION("Changing widgets")
+    {
+        std::vector<tgui::Widget::Ptr> pics;
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            auto pic = tgui::Picture::create("resources/image.png");
+            pic->setSize({40, 30});
+            wrap->add(pic);
+            pics.push_back(pic);
+        }
+
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(80, 0));
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(0, 30));
+        REQUIRE(pics[5]->getPosition() == sf::Vector2f(80, 30));
+
+        auto bigPic = tgui::Picture::create("resources/image.png");
+        bigPic->setSize({80, 50});
+        wrap->insert(4, bigPic);
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(0, 30));
+        REQUIRE(bigPic->getPosition() == sf::Vector2f(40, 30));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 80));
+        REQUIRE(pics[5]->getPosition() == sf::Vector2f(40, 80));
+
+        wrap->remove(bigPic);
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(40, 30));
+        REQUIRE(pics[5]->getPosition() == sf::Vector2f(80, 30));
+
+        // Resizing a child is taken into account the next time the widgets are placed
+        pics[0]->setSize({70, 30});
+        wrap->setSize({141, 400});
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(70, 0));
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(0, 30));
+        REQUIRE(pics[5]->getPosition() == sf::Vector2f(0, 60));
+
+        wrap->setSize({200, 400});
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(110, 0));
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(150, 0));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 30));
+
+        wrap->setSize({199, 400});
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(150, 0));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 30));
+
+        wrap->setSize({189, 400});
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(0, 30));
+    }
+
     testWidgetRenderer(wrap->getRenderer());
     SECTION("Renderer")
     {
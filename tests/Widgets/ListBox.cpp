@@ -237,6 +237,90 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getSelectedItemIndex() == -1);
     }
 
+    SECTION("Duplicate ids")
+    {
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+        listBox->addItem("Item 3", "1");
+        listBox->addItem("Item 4", "2");
+
+        REQUIRE(listBox->getItemById("1") == "Item 1");
+        REQUIRE(listBox->setSelectedItemById("2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        REQUIRE(listBox->removeItemById("1"));
+        REQUIRE(listBox->getItemById("1") == "Item 3");
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        REQUIRE(listBox->removeItemByIndex(0));
+        REQUIRE(listBox->getItemById("2") == "Item 4");
+        REQUIRE(listBox->containsId("1"));
+        REQUIRE(listBox->setSelectedItemById("2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        listBox->deselectItem();
+        listBox->setMaximumItems(1);
+        REQUIRE(!listBox->containsId("2"));
+        REQUIRE(listBox->getItemById("1") == "Item 3");
+    }
+
+    SECTION("Visible items")
+    {
+        // Only the visible items have a text object, these objects are reused for other items when scrolling
+        struct VisibleItemsListBox : public tgui::ListBox
+        {
+            std::vector<sf::String> getVisibleItemTexts()
+            {
+                sf::RenderTexture target;
+                target.create(100, 100);
+                draw(target, {});
+
+                std::vector<sf::String> texts;
+                for (const auto& text : m_visibleItems)
+                    texts.push_back(text.getString());
+                return texts;
+            }
+        };
+
+        VisibleItemsListBox visibleListBox;
+        visibleListBox.setSize(100, 100);
+        visibleListBox.setItemHeight(20);
+        visibleListBox.setAutoScroll(false);
+        for (unsigned int i = 0; i < 1000; ++i)
+            visibleListBox.addItem("Item " + tgui::to_string(i));
+
+        const auto requireVisibleItems = [&](unsigned int firstItem){
+            const auto texts = visibleListBox.getVisibleItemTexts();
+            REQUIRE(!texts.empty());
+            REQUIRE(texts.size() <= 6);
+            for (unsigned int i = 0; i < texts.size(); ++i)
+                REQUIRE(texts[i] == visibleListBox.getItemByIndex(firstItem + i));
+        };
+
+        requireVisibleItems(0);
+        REQUIRE(visibleListBox.getVisibleItemTexts().front() == "Item 0");
+
+        visibleListBox.setScrollbarValue(20 * 500 + 10);
+        requireVisibleItems(500);
+        REQUIRE(visibleListBox.getVisibleItemTexts().front() == "Item 500");
+
+        // Scrolling a few items reuses the texts of the items that are no longer visible
+        visibleListBox.setScrollbarValue(20 * 502);
+        requireVisibleItems(502);
+        visibleListBox.setScrollbarValue(20 * 499);
+        requireVisibleItems(499);
+        REQUIRE(visibleListBox.getVisibleItemTexts().front() == "Item 499");
+
+        // Changing and removing visible items updates the texts
+        visibleListBox.changeItemByIndex(500, "Changed");
+        requireVisibleItems(499);
+        REQUIRE(visibleListBox.getVisibleItemTexts()[1] == "Changed");
+
+        visibleListBox.removeItemByIndex(499);
+        requireVisibleItems(499);
+        REQUIRE(visibleListBox.getVisibleItemTexts().front() == "Changed");
+    }
+
     SECTION("Contains")
     {
         REQUIRE(!listBox->contains("Item 1"));
@@ -255,6 +339,101 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Search index")
+    {
+        listBox->addItem("Banana");
+        listBox->addItem("apple");
+        listBox->addItem("Apricot");
+        listBox->addItem("Cherry");
+        listBox->addItem("Apple");
+
+        REQUIRE(listBox->findItemsWithPrefix("ap") == std::vector<std::size_t>{1, 2, 4});
+        REQUIRE(listBox->findItemsWithPrefix("ap", 2) == std::vector<std::size_t>{1, 2});
+
+        REQUIRE(!listBox->isSearchIndexEnabled());
+        listBox->setSearchIndexEnabled(true);
+        REQUIRE(listBox->isSearchIndexEnabled());
+
+        REQUIRE(listBox->findItemsWithPrefix("AP") == std::vector<std::size_t>{1, 2, 4});
+        REQUIRE(listBox->findItemsWithPrefix("ap", 1) == std::vector<std::size_t>{1});
+        REQUIRE(listBox->findItemsWithPrefix("d").empty());
+
+        REQUIRE(listBox->setSelectedItem("Apple"));
+        REQUIRE(listBox->getSelectedItemIndex() == 4);
+        REQUIRE(listBox->contains("apple"));
+        REQUIRE(!listBox->contains("APPLE"));
+
+        REQUIRE(listBox->removeItem("apple"));
+        REQUIRE(listBox->findItemsWithPrefix("ap") == std::vector<std::size_t>{1, 3});
+        REQUIRE(listBox->getSelectedItemIndex() == 3);
+
+        REQUIRE(listBox->changeItem("Cherry", "Avocado"));
+        REQUIRE(listBox->findItemsWithPrefix("a") == std::vector<std::size_t>{1, 2, 3});
+        REQUIRE(listBox->findItemsWithPrefix("a", 2) == std::vector<std::size_t>{1, 2});
+
+        // The index is sorted alphabetically ("Item 10" comes before "Item 2"), but the results are in the order of the list
+        listBox->removeAllItems();
+        for (unsigned int i = 0; i < 100; ++i)
+            listBox->addItem("Item " + tgui::to_string(i));
+        REQUIRE(listBox->findItemsWithPrefix("item", 3) == std::vector<std::size_t>{0, 1, 2});
+        REQUIRE(listBox->findItemsWithPrefix("item 1", 2) == std::vector<std::size_t>{1, 10});
+
+        // Removing items near the end and near the front of the list
+        REQUIRE(listBox->removeItemByIndex(97));
+        REQUIRE(listBox->findItemsWithPrefix("item 99") == std::vector<std::size_t>{98});
+        REQUIRE(listBox->removeItemByIndex(0));
+        REQUIRE(listBox->findItemsWithPrefix("item 99") == std::vector<std::size_t>{97});
+        REQUIRE(listBox->findItemsWithPrefix("item 1", 1) == std::vector<std::size_t>{0});
+    }
+
+    SECTION("TypeAhead")
+    {
+        listBox->addItem("Banana");
+        listBox->addItem("apricot");
+        listBox->addItem("Cherry");
+        listBox->addItem("Apple");
+
+        // Typing doesn't change the selection unless type-ahead is enabled
+        REQUIRE(!listBox->isTypeAheadEnabled());
+        listBox->textEntered('b');
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
+
+        listBox->setTypeAheadEnabled(true);
+        REQUIRE(listBox->isTypeAheadEnabled());
+
+        unsigned int itemSelectedCount = 0;
+        listBox->connect("ItemSelected", [&](){ itemSelectedCount++; });
+
+        listBox->textEntered('b');
+        REQUIRE(listBox->getSelectedItem() == "Banana");
+        listBox->textEntered('A');
+        listBox->textEntered('n');
+        REQUIRE(listBox->getSelectedItem() == "Banana");
+        listBox->textEntered('x');
+        REQUIRE(listBox->getSelectedItem() == "Banana");
+        REQUIRE(itemSelectedCount == 1);
+
+        // The typed text is forgotten after a second without typing
+        const tgui::Widget::Ptr widget = listBox;
+        widget->update(sf::milliseconds(900));
+        listBox->textEntered('a');
+        REQUIRE(listBox->getSelectedItem() == "Banana");
+        widget->update(sf::milliseconds(1000));
+
+        // The first match in the list is selected, with or without search index
+        listBox->textEntered('a');
+        REQUIRE(listBox->getSelectedItem() == "apricot");
+        REQUIRE(itemSelectedCount == 2);
+
+        listBox->setSearchIndexEnabled(true);
+        widget->update(sf::milliseconds(1000));
+        listBox->textEntered('c');
+        REQUIRE(listBox->getSelectedItem() == "Cherry");
+        widget->update(sf::milliseconds(1000));
+        listBox->textEntered('a');
+        REQUIRE(listBox->getSelectedItem() == "apricot");
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
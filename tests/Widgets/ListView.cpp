@@ -87,6 +87,55 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getColumnAlignment(2) == tgui::ListView::ColumnAlignment::Center);
     }
 
+    SECTION("Auto-fit columns")
+    {
+        listView->addColumn("C", 200);
+        listView->addColumn("Col 2");
+        REQUIRE(!listView->getColumnAutoFit(0));
+        REQUIRE(listView->getColumnWidth(0) == 200);
+
+        listView->addItem({"Short", "x"});
+        listView->addItem({"A much longer text", "x"});
+
+        listView->setColumnAutoFit(0, true);
+        REQUIRE(listView->getColumnAutoFit(0));
+        const float longWidth = listView->getColumnWidth(0);
+        REQUIRE(longWidth < 200);
+
+        listView->addItem("Short again");
+        REQUIRE(listView->getColumnWidth(0) == longWidth);
+
+        listView->removeItem(1);
+        const float shortWidth = listView->getColumnWidth(0);
+        REQUIRE(shortWidth < longWidth);
+
+        listView->changeSubItem(0, 0, "A much longer text");
+        REQUIRE(listView->getColumnWidth(0) == longWidth);
+
+        listView->changeItem(0, {"S"});
+        REQUIRE(listView->getColumnWidth(0) == shortWidth);
+
+        listView->setTextSize(listView->getTextSize() * 2);
+        REQUIRE(listView->getColumnWidth(0) > shortWidth);
+
+        // Changing a column behind the last text also adds empty texts for the columns in between
+        listView->setColumnAutoFit(1, true);
+        const float emptyWidth = listView->getColumnWidth(1);
+        listView->changeSubItem(0, 2, "Text behind an empty column");
+        REQUIRE(listView->getColumnWidth(1) == emptyWidth);
+        listView->changeSubItem(0, 1, "A much longer text");
+        REQUIRE(listView->getColumnWidth(1) > emptyWidth);
+        listView->removeItem(0);
+        REQUIRE(listView->getColumnWidth(1) == emptyWidth);
+
+        listView->removeAllItems();
+        REQUIRE(listView->getColumnWidth(0) > 0);
+        REQUIRE(listView->getColumnWidth(0) < shortWidth);
+
+        listView->setColumnAutoFit(0, false);
+        REQUIRE(listView->getColumnWidth(0) == 200);
+    }
+
     SECTION("Changing columns")
     {
         listView->addColumn("Col 1");
@@ -180,6 +229,61 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<sf::String>>{{"1,1", "a,2"}, {"b,1", ""}, {"c,1", "c,2"}});
     }
     
+    SECTION("Changing and removing multiple items")
+    {
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addMultipleItems({{"1,1"}, {"2,1"}, {"3,1"}, {"4,1"}, {"5,1"}});
+
+        REQUIRE(listView->changeItems(1, {{"b,1", "b,2"}, {"c,1"}}));
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<sf::String>>{{"1,1", ""}, {"b,1", "b,2"}, {"c,1", ""}, {"4,1", ""}, {"5,1", ""}});
+        REQUIRE(!listView->changeItems(4, {{"x"}, {"y"}}));
+        REQUIRE(listView->getItem(4) == "5,1");
+
+        listView->setSelectedItem(4);
+        REQUIRE(!listView->removeItems(3, 3));
+        REQUIRE(listView->getItemCount() == 5);
+        REQUIRE(listView->removeItems(1, 2));
+        REQUIRE(listView->getItems() == std::vector<sf::String>{"1,1", "4,1", "5,1"});
+        REQUIRE(listView->getSelectedItemIndex() == 2);
+
+        REQUIRE(listView->removeItems(1, 2));
+        REQUIRE(listView->getItems() == std::vector<sf::String>{"1,1"});
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+    }
+
+    SECTION("Batched updates")
+    {
+        listView->setSize(200, 100);
+        listView->setItemHeight(20);
+
+        unsigned int selectCount = 0;
+        int selectedIndex = -2;
+        listView->connect("ItemSelected", [&](int index){ ++selectCount; selectedIndex = index; });
+
+        REQUIRE(!listView->isUpdating());
+        listView->beginUpdate();
+        listView->beginUpdate();
+        REQUIRE(listView->isUpdating());
+
+        for (unsigned int i = 0; i < 20; ++i)
+            listView->addItem("Item");
+        listView->setSelectedItem(3);
+        listView->setSelectedItem(5);
+        REQUIRE(listView->getSelectedItemIndex() == 5);
+
+        listView->endUpdate();
+        REQUIRE(listView->isUpdating());
+        REQUIRE(selectCount == 0);
+        REQUIRE(listView->getVerticalScrollbarValue() == 0);
+
+        listView->endUpdate();
+        REQUIRE(!listView->isUpdating());
+        REQUIRE(selectCount == 1);
+        REQUIRE(selectedIndex == 5);
+        REQUIRE(listView->getVerticalScrollbarValue() > 0);
+    }
+
     SECTION("Sort")
     {
         listView->addColumn("Col 1");
@@ -209,6 +313,48 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<sf::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
     }
 
+    SECTION("Cell styles")
+    {
+        listView->addMultipleItems({{"3", "c"}, {"1", "a"}, {"2", "b"}, {"4", "d"}});
+
+        REQUIRE(!listView->getCellStyle(0, 1).textColor.isSet());
+
+        tgui::ListView::CellStyle style;
+        style.textColor = sf::Color::Red;
+        style.backgroundColor = sf::Color::Green;
+        listView->setCellStyle(0, 1, style);
+        style.textColor = sf::Color::Blue;
+        style.textStyle = sf::Text::Bold;
+        listView->setCellStyle(2, 0, style);
+        listView->setCellStyle(3, 1, style);
+
+        REQUIRE(listView->getCellStyle(0, 1).textColor == sf::Color::Red);
+        REQUIRE(listView->getCellStyle(0, 1).backgroundColor == sf::Color::Green);
+        REQUIRE(!listView->getCellStyle(0, 1).textStyle.isSet());
+        REQUIRE(listView->getCellStyle(2, 0).textStyle == sf::Text::Bold);
+        REQUIRE(!listView->getCellStyle(0, 0).textColor.isSet());
+
+        // Styles move along with their items
+        listView->sort(0, [](const sf::String& a, const sf::String& b) { return a < b; });
+        REQUIRE(listView->getItems() == std::vector<sf::String>{"1", "2", "3", "4"});
+        REQUIRE(listView->getCellStyle(2, 1).textColor == sf::Color::Red);
+        REQUIRE(listView->getCellStyle(1, 0).textColor == sf::Color::Blue);
+        REQUIRE(listView->getCellStyle(3, 1).textColor == sf::Color::Blue);
+        REQUIRE(!listView->getCellStyle(0, 1).textColor.isSet());
+
+        listView->removeItem(1);
+        REQUIRE(listView->getCellStyle(1, 1).textColor == sf::Color::Red);
+        REQUIRE(listView->getCellStyle(2, 1).textColor == sf::Color::Blue);
+        REQUIRE(!listView->getCellStyle(1, 0).textColor.isSet());
+
+        listView->removeCellStyle(1, 1);
+        REQUIRE(!listView->getCellStyle(1, 1).textColor.isSet());
+        REQUIRE(listView->getCellStyle(2, 1).textColor == sf::Color::Blue);
+
+        listView->removeAllCellStyles();
+        REQUIRE(!listView->getCellStyle(2, 1).textColor.isSet());
+    }
+
     SECTION("Returned item rows depend on columns")
     {
         listView->addItem({"1,1", "1,2", "1,3"});
@@ -739,6 +885,7 @@ TEST_CASE("[ListView]")
         listView->addItem("1,1");
         listView->addItem({"2,1", "2,2", "2,3"});
         listView->addItem({"3,1", "3,2"});
+        listView->setColumnAutoFit(3, true);
         listView->setItemHeight(25);
         listView->setSelectedItem(1);
         listView->setTextSize(20);
@@ -78,6 +78,54 @@ TEST_CASE("[ScrollablePanel]")
         }
     }
 
+    SECTION("ContentSize")
+    {
+        panel->setSize(150, 100);
+        REQUIRE(panel->getContentSize() == panel->getInnerSize());
+
+        auto widget1 = tgui::ClickableWidget::create({40, 30});
+        widget1->setPosition(20, 10);
+        panel->add(widget1);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(60, 40));
+
+        auto widget2 = tgui::ClickableWidget::create({40, 30});
+        widget2->setPosition(200, 10);
+        panel->add(widget2);
+        auto widget3 = tgui::ClickableWidget::create({40, 30});
+        widget3->setPosition(200, 150);
+        panel->add(widget3);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(240, 180));
+
+        widget3->setSize(20, 20);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(240, 170));
+
+        widget3->setPosition(0, 0);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(240, 40));
+
+        panel->remove(widget2);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(60, 40));
+
+        // Widgets with the same edges are tracked separately
+        widget3->setPosition(20, 10);
+        widget3->setSize(40, 30);
+        panel->remove(widget1);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(60, 40));
+
+        widget1->setPosition(500, 500);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(60, 40));
+
+        panel->setContentSize({300, 200});
+        REQUIRE(panel->getContentSize() == sf::Vector2f(300, 200));
+        widget3->setPosition(400, 400);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(300, 200));
+
+        panel->setContentSize({0, 0});
+        REQUIRE(panel->getContentSize() == sf::Vector2f(440, 430));
+
+        panel->removeAllWidgets();
+        REQUIRE(panel->getContentSize() == panel->getInnerSize());
+    }
+
     SECTION("VerticalScrollbarPolicy")
     {
         REQUIRE(panel->getVerticalScrollbarPolicy() == tgui::Scrollbar::Policy::Automatic);
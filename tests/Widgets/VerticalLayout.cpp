@@ -109,6 +109,32 @@ TEST_CASE("[VerticalLayout]")
         }
     }
 
+    SECTION("Batched updates")
+    {
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+
+        layout->beginUpdate();
+        REQUIRE(layout->isUpdating());
+        layout->add(button1);
+        layout->add(button2);
+
+        // The widgets are only positioned when endUpdate is called
+        REQUIRE(button2->getPosition() == sf::Vector2f(0, 0));
+
+        layout->endUpdate();
+        REQUIRE(!layout->isUpdating());
+        REQUIRE(button2->getPosition() == sf::Vector2f(0, 400));
+        REQUIRE(button1->getFullSize() == sf::Vector2f(1000, 400));
+        REQUIRE(button2->getFullSize() == sf::Vector2f(1000, 400));
+
+        layout->addMultiple({tgui::Button::create(), tgui::Button::create()}, {"3", "4"});
+        REQUIRE(layout->getWidgets().size() == 4);
+        REQUIRE(layout->getWidgetNames()[3] == "4");
+        REQUIRE(layout->get(3)->getPosition() == sf::Vector2f(0, 600));
+        REQUIRE(layout->get(3)->getFullSize() == sf::Vector2f(1000, 200));
+    }
+
     SECTION("Order")
     {
         REQUIRE(layout->get(0) == nullptr);